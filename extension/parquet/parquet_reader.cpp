@@ -28,6 +28,7 @@
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -712,6 +713,13 @@ static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, con
 		return StringStats::CheckZonemap(const_data_ptr_cast(min_value.c_str()), min_value.size(),
 		                                 const_data_ptr_cast(max_value.c_str()), max_value.size(),
 		                                 constant_filter.comparison_type, StringValue::Get(constant_filter.constant));
+	} else if (filter.filter_type == TableFilterType::DYNAMIC_FILTER) {
+		// check the current value of the dynamic filter against the full strings as well
+		auto constant_filter = filter.Cast<DynamicFilter>().filter_data->GetFilter();
+		if (!constant_filter) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return CheckParquetStringFilter(stats, pq_col_stats, *constant_filter);
 	} else {
 		return filter.CheckStatistics(stats);
 	}
@@ -983,6 +991,13 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		}
 		break;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto constant_filter = filter.Cast<DynamicFilter>().filter_data->GetFilter();
+		if (constant_filter) {
+			ApplyFilter(v, *constant_filter, filter_mask, count);
+		}
+		break;
+	}
 	case TableFilterType::IS_NOT_NULL:
 		FilterIsNotNull(v, filter_mask, count);
 		break;
@@ -86,7 +86,6 @@ ignored_files = [
     'icu-collate.hpp',
     'yyjson.cpp',
     'yyjson.hpp',
-    'duckdb_pdqsort.hpp',
     'stubdata.cpp',
     'nf_calendar.cpp',
     'nf_calendar.h',
@@ -21,7 +21,7 @@ namespace duckdb {
 
 TableCatalogEntry::TableCatalogEntry(Catalog &catalog, SchemaCatalogEntry &schema, CreateTableInfo &info)
     : StandardEntry(CatalogType::TABLE_ENTRY, schema, catalog, info.table), columns(std::move(info.columns)),
-      constraints(std::move(info.constraints)) {
+      constraints(std::move(info.constraints)), cluster_by(info.cluster_by) {
 	this->temporary = info.temporary;
 	this->dependencies = info.dependencies;
 	this->comment = info.comment;
@@ -71,6 +71,7 @@ unique_ptr<CreateInfo> TableCatalogEntry::GetInfo() const {
 	              [&result](const unique_ptr<Constraint> &c) { result->constraints.emplace_back(c->Copy()); });
 	result->comment = comment;
 	result->tags = tags;
+	result->cluster_by = cluster_by;
 	return std::move(result);
 }
 
@@ -193,6 +194,10 @@ const vector<unique_ptr<Constraint>> &TableCatalogEntry::GetConstraints() const
 	return constraints;
 }
 
+const vector<string> &TableCatalogEntry::GetClusterBy() const {
+	return cluster_by;
+}
+
 // LCOV_EXCL_START
 DataTable &TableCatalogEntry::GetStorage() {
 	throw InternalException("Calling GetStorage on a TableCatalogEntry that is not a DuckTableEntry");
@@ -32,6 +32,10 @@
 #include <malloc.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+#include <sys/mman.h>
+#endif
+
 namespace duckdb {
 
 AllocatedData::AllocatedData() : allocator(nullptr), pointer(nullptr), allocated_size(0) {
@@ -284,6 +288,21 @@ void Allocator::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+bool Allocator::AdviseHugePages(data_ptr_t pointer, idx_t size) {
+#if defined(__linux__) && !defined(DUCKDB_WASM) && defined(MADV_HUGEPAGE)
+	// huge pages can only back the huge-page-aligned part of the allocation
+	auto start = AlignValue<uintptr_t, HUGE_PAGE_SIZE>(CastPointerToValue(pointer));
+	auto end = AlignValueFloor<uintptr_t, HUGE_PAGE_SIZE>(CastPointerToValue(pointer) + size);
+	if (start >= end) {
+		return false;
+	}
+	// this is only advice: if transparent huge pages are disabled the allocation keeps using regular pages
+	return madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE) == 0;
+#else
+	return false;
+#endif
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Info (extended)
 //===--------------------------------------------------------------------===//
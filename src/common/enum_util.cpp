@@ -15,6 +15,7 @@
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
+#include "duckdb/common/enums/buffer_access_pattern.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
@@ -54,6 +55,7 @@
 #include "duckdb/common/enums/stream_execution_result.hpp"
 #include "duckdb/common/enums/subquery_type.hpp"
 #include "duckdb/common/enums/tableref_type.hpp"
+#include "duckdb/common/enums/temporary_file_compression.hpp"
 #include "duckdb/common/enums/undo_flags.hpp"
 #include "duckdb/common/enums/vector_type.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
@@ -773,6 +775,29 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BlockState>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<BufferAccessPattern>(BufferAccessPattern value) {
+	switch(value) {
+	case BufferAccessPattern::RANDOM:
+		return "RANDOM";
+	case BufferAccessPattern::SEQUENTIAL:
+		return "SEQUENTIAL";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<BufferAccessPattern>", value));
+	}
+}
+
+template<>
+BufferAccessPattern EnumUtil::FromString<BufferAccessPattern>(const char *value) {
+	if (StringUtil::Equals(value, "RANDOM")) {
+		return BufferAccessPattern::RANDOM;
+	}
+	if (StringUtil::Equals(value, "SEQUENTIAL")) {
+		return BufferAccessPattern::SEQUENTIAL;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<BufferAccessPattern>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value) {
 	switch(value) {
@@ -4297,6 +4322,10 @@ const char* EnumUtil::ToChars<MemoryTag>(MemoryTag value) {
 		return "ALLOCATOR";
 	case MemoryTag::EXTENSION:
 		return "EXTENSION";
+	case MemoryTag::AGGREGATE_STATE:
+		return "AGGREGATE_STATE";
+	case MemoryTag::WINDOW:
+		return "WINDOW";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<MemoryTag>", value));
 	}
@@ -4340,6 +4369,12 @@ MemoryTag EnumUtil::FromString<MemoryTag>(const char *value) {
 	if (StringUtil::Equals(value, "EXTENSION")) {
 		return MemoryTag::EXTENSION;
 	}
+	if (StringUtil::Equals(value, "AGGREGATE_STATE")) {
+		return MemoryTag::AGGREGATE_STATE;
+	}
+	if (StringUtil::Equals(value, "WINDOW")) {
+		return MemoryTag::WINDOW;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<MemoryTag>", value));
 }
 
@@ -5424,6 +5459,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INTERVAL_JOIN:
+		return "INTERVAL_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -5626,6 +5663,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INTERVAL_JOIN")) {
+		return PhysicalOperatorType::INTERVAL_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -7412,6 +7452,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<TableFilterType>", value));
 	}
@@ -7437,6 +7479,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TableFilterType>", value));
 }
 
@@ -7607,6 +7652,57 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TaskExecutionResult>", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TaskPriority>(TaskPriority value) {
+	switch(value) {
+	case TaskPriority::HIGH:
+		return "HIGH";
+	case TaskPriority::NORMAL:
+		return "NORMAL";
+	case TaskPriority::LOW:
+		return "LOW";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<TaskPriority>", value));
+	}
+}
+
+template<>
+TaskPriority EnumUtil::FromString<TaskPriority>(const char *value) {
+	if (StringUtil::Equals(value, "HIGH")) {
+		return TaskPriority::HIGH;
+	}
+	if (StringUtil::Equals(value, "NORMAL")) {
+		return TaskPriority::NORMAL;
+	}
+	if (StringUtil::Equals(value, "LOW")) {
+		return TaskPriority::LOW;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TaskPriority>", value));
+}
+
+template<>
+const char* EnumUtil::ToChars<TemporaryFileCompression>(TemporaryFileCompression value) {
+	switch(value) {
+	case TemporaryFileCompression::NONE:
+		return "NONE";
+	case TemporaryFileCompression::LZ4:
+		return "LZ4";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented in ToChars<TemporaryFileCompression>", value));
+	}
+}
+
+template<>
+TemporaryFileCompression EnumUtil::FromString<TemporaryFileCompression>(const char *value) {
+	if (StringUtil::Equals(value, "NONE")) {
+		return TemporaryFileCompression::NONE;
+	}
+	if (StringUtil::Equals(value, "LZ4")) {
+		return TemporaryFileCompression::LZ4;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented in FromString<TemporaryFileCompression>", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
@@ -47,6 +47,14 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #endif
 #include <fcntl.h>
 #include <libgen.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__has_include)
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#include <linux/io_uring.h>
+#define DUCKDB_IO_URING
+#endif
+#endif
 // See e.g.:
 // https://opensource.apple.com/source/CarbonHeaders/CarbonHeaders-18.1/TargetConditionals.h.auto.html
 #elif defined(__APPLE__)
@@ -460,6 +468,325 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+#ifdef DUCKDB_IO_URING
+//! A minimal io_uring submission/completion queue pair that is used to issue a batch of reads at once
+class IOUringQueue {
+public:
+	//! The maximum amount of reads that are in flight at the same time
+	static constexpr const unsigned QUEUE_DEPTH = 64;
+
+	~IOUringQueue() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+		}
+		if (cq_ptr && cq_ptr != sq_ptr) {
+			munmap(cq_ptr, cq_size);
+		}
+		if (sq_ptr) {
+			munmap(sq_ptr, sq_size);
+		}
+		close(ring_fd);
+	}
+
+	//! Creates a new queue - returns nullptr if io_uring is not available (e.g. old kernels or blocked by seccomp)
+	static unique_ptr<IOUringQueue> TryCreate() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto ring_fd = static_cast<int>(syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params));
+		if (ring_fd < 0) {
+			return nullptr;
+		}
+		auto queue = unique_ptr<IOUringQueue>(new IOUringQueue(ring_fd));
+		if (!queue->MapRings(params)) {
+			return nullptr;
+		}
+		return queue;
+	}
+
+	//! Reads all requests, keeping up to QUEUE_DEPTH reads in flight. Returns false if io_uring does not support
+	//! the read operation, in which case the caller has to perform the reads in a different manner.
+	bool Read(FileHandle &handle, int fd, vector<FileReadRequest> &requests) {
+		vector<idx_t> bytes_read(requests.size(), 0);
+		vector<idx_t> pending;
+		for (idx_t i = requests.size(); i > 0; i--) {
+			if (requests[i - 1].nr_bytes > 0) {
+				pending.push_back(i - 1);
+			}
+		}
+		// the first error we encounter - we only report it after all reads that are in flight have completed
+		string error;
+		idx_t in_flight = 0;
+		unsigned unsubmitted = 0;
+		while (in_flight > 0 || (!pending.empty() && error.empty())) {
+			// fill up the submission queue
+			while (!pending.empty() && error.empty() && in_flight < sq_entries) {
+				auto request_idx = pending.back();
+				pending.pop_back();
+				PrepareRead(fd, requests[request_idx], bytes_read[request_idx], request_idx);
+				unsubmitted++;
+				in_flight++;
+			}
+			// submit the reads and wait for at least one of them to complete
+			auto rc = syscall(__NR_io_uring_enter, ring_fd, unsubmitted, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (rc < 0) {
+				if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+					// the submission queue is in an unknown state - never re-use this queue
+					broken = true;
+					if (error.empty()) {
+						error = StringUtil::Format("Could not submit reads for file \"%s\": %s", handle.path,
+						                           strerror(errno));
+					}
+				}
+				// the completion queue might be full (EBUSY) - drain it before retrying the submission
+				rc = 0;
+			}
+			unsubmitted -= UnsafeNumericCast<unsigned>(rc);
+			// process the completions
+			auto head = __atomic_load_n(cq_head, __ATOMIC_ACQUIRE);
+			while (head != __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+				auto &cqe = cqes[head & *cq_mask];
+				auto request_idx = UnsafeNumericCast<idx_t>(cqe.user_data);
+				auto result = cqe.res;
+				head++;
+				in_flight--;
+
+				auto &request = requests[request_idx];
+				if (result == -EINTR || result == -EAGAIN) {
+					pending.push_back(request_idx);
+				} else if (result == -EINVAL || result == -EOPNOTSUPP) {
+					// the kernel does not support IORING_OP_READ
+					unsupported = true;
+					if (error.empty()) {
+						error = "IORING_OP_READ is not supported";
+					}
+				} else if (result < 0) {
+					if (error.empty()) {
+						error = StringUtil::Format("Could not read from file \"%s\": %s", handle.path, strerror(-result));
+					}
+				} else if (result == 0) {
+					if (error.empty()) {
+						error = StringUtil::Format("Could not read enough bytes from file \"%s\": attempted to read "
+						                           "%llu bytes from location %llu",
+						                           handle.path, request.nr_bytes, request.location);
+					}
+				} else {
+					bytes_read[request_idx] += UnsafeNumericCast<idx_t>(result);
+					if (bytes_read[request_idx] < request.nr_bytes) {
+						// short read - read the remainder
+						pending.push_back(request_idx);
+					}
+				}
+			}
+			__atomic_store_n(cq_head, head, __ATOMIC_RELEASE);
+			if (broken) {
+				// we can not wait for the reads that are still in flight on a broken queue
+				// they are cancelled when the queue is destroyed, as it is not re-used
+				break;
+			}
+		}
+		if (unsupported) {
+			return false;
+		}
+		if (!error.empty()) {
+			throw IOException(error);
+		}
+		return true;
+	}
+
+	//! Whether or not the queue can be re-used for subsequent reads
+	bool Reusable() const {
+		return !broken && !unsupported;
+	}
+
+	bool Unsupported() const {
+		return unsupported;
+	}
+
+private:
+	explicit IOUringQueue(int ring_fd) : ring_fd(ring_fd) {
+	}
+
+	void PrepareRead(int fd, FileReadRequest &request, idx_t offset, idx_t request_idx) {
+		auto remaining = MinValue<idx_t>(request.nr_bytes - offset, NumericLimits<int32_t>::Maximum());
+		auto tail = *sq_tail;
+		auto index = tail & *sq_mask;
+		auto &sqe = sqes[index];
+		memset(&sqe, 0, sizeof(sqe));
+		sqe.opcode = IORING_OP_READ;
+		sqe.fd = fd;
+		sqe.addr = reinterpret_cast<uint64_t>(char_ptr_cast(request.buffer) + offset);
+		sqe.len = UnsafeNumericCast<uint32_t>(remaining);
+		sqe.off = request.location + offset;
+		sqe.user_data = request_idx;
+		sq_array[index] = index;
+		__atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+	}
+
+	bool MapRings(const io_uring_params &params) {
+		sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+		cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+		single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+#endif
+		if (single_mmap) {
+			sq_size = MaxValue<size_t>(sq_size, cq_size);
+			cq_size = sq_size;
+		}
+		sq_ptr = MapRing(sq_size, IORING_OFF_SQ_RING);
+		if (!sq_ptr) {
+			return false;
+		}
+		cq_ptr = single_mmap ? sq_ptr : MapRing(cq_size, IORING_OFF_CQ_RING);
+		if (!cq_ptr) {
+			return false;
+		}
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		sqes = static_cast<io_uring_sqe *>(MapRing(sqes_size, IORING_OFF_SQES));
+		if (!sqes) {
+			return false;
+		}
+		auto sq = static_cast<char *>(sq_ptr);
+		sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+		sq_mask = reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+		sq_entries = params.sq_entries;
+		auto cq = static_cast<char *>(cq_ptr);
+		cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+		cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+		cq_mask = reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+		return true;
+	}
+
+	void *MapRing(size_t size, off_t offset) {
+		auto result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+		return result == MAP_FAILED ? nullptr : result;
+	}
+
+private:
+	int ring_fd;
+	//! Whether or not the kernel supports IORING_OP_READ
+	bool unsupported = false;
+	//! Whether or not submitting to the queue failed
+	bool broken = false;
+	void *sq_ptr = nullptr;
+	size_t sq_size = 0;
+	void *cq_ptr = nullptr;
+	size_t cq_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	size_t sqes_size = 0;
+	unsigned sq_entries = 0;
+	unsigned *sq_tail = nullptr;
+	unsigned *sq_mask = nullptr;
+	unsigned *sq_array = nullptr;
+	unsigned *cq_head = nullptr;
+	unsigned *cq_tail = nullptr;
+	unsigned *cq_mask = nullptr;
+	io_uring_cqe *cqes = nullptr;
+};
+
+//! Queues are expensive to set up - keep idle queues around so they can be re-used by subsequent batches
+class IOUringQueuePool {
+public:
+	unique_ptr<IOUringQueue> Acquire() {
+		{
+			lock_guard<mutex> guard(lock);
+			if (!available) {
+				return nullptr;
+			}
+			if (!idle_queues.empty()) {
+				auto result = std::move(idle_queues.back());
+				idle_queues.pop_back();
+				return result;
+			}
+		}
+		auto result = IOUringQueue::TryCreate();
+		if (!result) {
+			lock_guard<mutex> guard(lock);
+			available = false;
+		}
+		return result;
+	}
+
+	void Release(unique_ptr<IOUringQueue> queue) {
+		lock_guard<mutex> guard(lock);
+		if (queue->Unsupported()) {
+			available = false;
+		}
+		if (available && queue->Reusable() && idle_queues.size() < MAX_IDLE_QUEUES) {
+			idle_queues.push_back(std::move(queue));
+		}
+	}
+
+	static IOUringQueuePool &Get() {
+		static IOUringQueuePool pool;
+		return pool;
+	}
+
+private:
+	static constexpr const idx_t MAX_IDLE_QUEUES = 16;
+
+	mutex lock;
+	//! Whether or not io_uring can be used on this system
+	bool available = true;
+	vector<unique_ptr<IOUringQueue>> idle_queues;
+};
+#endif
+
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+#ifdef DUCKDB_IO_URING
+	if (requests.size() > 1) {
+		auto &pool = IOUringQueuePool::Get();
+		auto queue = pool.Acquire();
+		if (queue) {
+			bool success = false;
+			try {
+				success = queue->Read(handle, handle.Cast<UnixFileHandle>().fd, requests);
+			} catch (...) {
+				pool.Release(std::move(queue));
+				throw;
+			}
+			pool.Release(std::move(queue));
+			if (success) {
+				return;
+			}
+		}
+	}
+#endif
+	FileSystem::ReadBatch(handle, requests);
+}
+
+struct UnixFileMemoryMapping : public FileMemoryMapping {
+	UnixFileMemoryMapping(void *address, idx_t size)
+	    : FileMemoryMapping(data_ptr_cast(address), size), address(address) {
+	}
+	~UnixFileMemoryMapping() override {
+		munmap(address, size);
+	}
+
+	void Release(data_ptr_t range, idx_t range_size) override {
+		// drop the pages (and any private copies of them) - they are faulted in from the file again on access
+		madvise(range, range_size, MADV_DONTNEED);
+	}
+
+	void *address;
+};
+
+unique_ptr<FileMemoryMapping> LocalFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	if (size == 0) {
+		return nullptr;
+	}
+	int fd = handle.Cast<UnixFileHandle>().fd;
+	// the mapping is private: writes to it create private copies of the pages and never reach the file
+	auto address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	if (address == MAP_FAILED) {
+		// the file cannot be mapped (e.g., because it lives on a file system that does not support it) - fall back
+		return nullptr;
+	}
+	return make_uniq<UnixFileMemoryMapping>(address, size);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -890,6 +1217,14 @@ static DWORD FSInternalRead(FileHandle &handle, HANDLE hFile, void *buffer, int6
 	return bytes_read;
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	FileSystem::ReadBatch(handle, requests);
+}
+
+unique_ptr<FileMemoryMapping> LocalFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	return nullptr;
+}
+
 void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) {
 	HANDLE hFile = ((WindowsFileHandle &)handle).fd;
 	auto bytes_read = FSInternalRead(handle, hFile, buffer, nr_bytes, location);
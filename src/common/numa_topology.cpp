@@ -0,0 +1,118 @@
+#include "duckdb/common/numa_topology.hpp"
+
+#include "duckdb/common/string_util.hpp"
+
+namespace duckdb {
+
+NumaTopology::NumaTopology() {
+}
+
+void NumaTopology::AddNode(vector<idx_t> cpus) {
+	auto node = node_cpus.size();
+	for (auto &cpu : cpus) {
+		if (cpu >= cpu_nodes.size()) {
+			cpu_nodes.resize(cpu + 1, 0);
+		}
+		cpu_nodes[cpu] = node;
+	}
+	node_cpus.push_back(std::move(cpus));
+}
+
+//! Parses a single CPU id - only plain decimal numbers are accepted
+static bool TryParseCPU(const string &cpu_list, idx_t begin, idx_t end, idx_t &result) {
+	if (begin == end) {
+		return false;
+	}
+	result = 0;
+	for (idx_t i = begin; i < end; i++) {
+		if (!StringUtil::CharacterIsDigit(cpu_list[i])) {
+			return false;
+		}
+		result = result * 10 + idx_t(cpu_list[i] - '0');
+		if (result > NumaTopology::MAX_CPU_ID) {
+			return false;
+		}
+	}
+	return true;
+}
+
+vector<idx_t> NumaTopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	idx_t entry_begin = 0;
+	while (entry_begin < cpu_list.size()) {
+		auto entry_end = cpu_list.find(',', entry_begin);
+		if (entry_end == string::npos) {
+			entry_end = cpu_list.size();
+		}
+		// every entry is either a single CPU or a range of CPUs ("start-end")
+		auto separator = cpu_list.find('-', entry_begin);
+		if (separator >= entry_end) {
+			separator = entry_end;
+		}
+		idx_t start, end;
+		if (!TryParseCPU(cpu_list, entry_begin, separator, start)) {
+			return vector<idx_t>();
+		}
+		if (separator == entry_end) {
+			end = start;
+		} else if (!TryParseCPU(cpu_list, separator + 1, entry_end, end) || end < start) {
+			return vector<idx_t>();
+		}
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+		if (entry_end == cpu_list.size()) {
+			break;
+		}
+		entry_begin = entry_end + 1;
+		if (entry_begin == cpu_list.size()) {
+			// trailing comma
+			return vector<idx_t>();
+		}
+	}
+	return result;
+}
+
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+static string ReadSysFile(FileSystem &fs, const string &path) {
+	if (!fs.FileExists(path)) {
+		return string();
+	}
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	char buffer[4096];
+	auto bytes_read = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+	buffer[bytes_read] = '\0';
+	auto result = string(buffer);
+	StringUtil::Trim(result);
+	return result;
+}
+#endif
+
+NumaTopology NumaTopology::Detect(FileSystem &fs) {
+	NumaTopology result;
+#if defined(__linux__) && !defined(DUCKDB_WASM)
+	try {
+		auto nodes = ParseCPUList(ReadSysFile(fs, "/sys/devices/system/node/online"));
+		for (auto &node : nodes) {
+			auto cpulist_path = StringUtil::Format("/sys/devices/system/node/node%llu/cpulist", node);
+			auto cpus = ParseCPUList(ReadSysFile(fs, cpulist_path));
+			if (cpus.empty()) {
+				// memory-only node - threads cannot be scheduled on it
+				continue;
+			}
+			result.AddNode(std::move(cpus));
+		}
+	} catch (...) {
+		// failed to read the topology - fall back to a single node below
+		result = NumaTopology();
+	}
+#endif
+	if (result.NodeCount() <= 1) {
+		// a single node - there are no NUMA effects we need to take into account
+		result = NumaTopology();
+		result.AddNode(vector<idx_t>());
+	}
+	return result;
+}
+
+} // namespace duckdb
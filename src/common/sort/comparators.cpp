@@ -492,6 +492,10 @@ int Comparators::TemplatedCompareListLoop(data_ptr_t &left_ptr, data_ptr_t &righ
 
 void Comparators::UnswizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &heap_ptr, const LogicalType &type) {
 	if (type.InternalType() == PhysicalType::VARCHAR) {
+		if (Load<uint32_t>(data_ptr) <= string_t::INLINE_LENGTH) {
+			// Inlined strings are not swizzled
+			return;
+		}
 		data_ptr += string_t::HEADER_SIZE;
 	}
 	Store<data_ptr_t>(heap_ptr + Load<idx_t>(data_ptr), data_ptr);
@@ -499,6 +503,10 @@ void Comparators::UnswizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &he
 
 void Comparators::SwizzleSingleValue(data_ptr_t data_ptr, const data_ptr_t &heap_ptr, const LogicalType &type) {
 	if (type.InternalType() == PhysicalType::VARCHAR) {
+		if (Load<uint32_t>(data_ptr) <= string_t::INLINE_LENGTH) {
+			// Inlined strings are not swizzled
+			return;
+		}
 		data_ptr += string_t::HEADER_SIZE;
 	}
 	Store<idx_t>(UnsafeNumericCast<idx_t>(Load<data_ptr_t>(data_ptr) - heap_ptr), data_ptr);
@@ -22,21 +22,33 @@ PartitionGlobalHashGroup::PartitionGlobalHashGroup(BufferManager &buffer_manager
 	partition_layout = global_sort->sort_layout.GetPrefixComparisonLayout(partitions.size());
 }
 
-void PartitionGlobalHashGroup::ComputeMasks(ValidityMask &partition_mask, OrderMasks &order_masks) {
-	D_ASSERT(count > 0);
+void PartitionGlobalHashGroup::ComputeMasks(ValidityMask &partition_mask, OrderMasks &order_masks, idx_t begin,
+                                            idx_t end) {
+	D_ASSERT(begin < end && end <= count);
 
-	SBIterator prev(*global_sort, ExpressionType::COMPARE_LESSTHAN);
-	SBIterator curr(*global_sort, ExpressionType::COMPARE_LESSTHAN);
-
-	partition_mask.SetValidUnsafe(0);
 	unordered_map<idx_t, SortLayout> prefixes;
 	for (auto &order_mask : order_masks) {
-		order_mask.second.SetValidUnsafe(0);
 		D_ASSERT(order_mask.first >= partition_layout.column_count);
 		prefixes[order_mask.first] = global_sort->sort_layout.GetPrefixComparisonLayout(order_mask.first);
 	}
 
-	for (++curr; curr.GetIndex() < count; ++curr) {
+	//	The first row always starts a partition
+	if (!begin) {
+		partition_mask.SetValidUnsafe(0);
+		for (auto &order_mask : order_masks) {
+			order_mask.second.SetValidUnsafe(0);
+		}
+		++begin;
+	}
+
+	if (begin >= end) {
+		return;
+	}
+
+	SBIterator prev(*global_sort, ExpressionType::COMPARE_LESSTHAN, begin - 1);
+	SBIterator curr(*global_sort, ExpressionType::COMPARE_LESSTHAN, begin);
+
+	for (; curr.GetIndex() < end; ++curr) {
 		//	Compare the partition subset first because if that differs, then so does the full ordering
 		const auto part_cmp = ComparePartitions(prev, curr);
 
@@ -552,12 +564,16 @@ bool PartitionGlobalMergeState::TryPrepareNextStage() {
 	return true;
 }
 
-PartitionGlobalMergeStates::PartitionGlobalMergeStates(PartitionGlobalSinkState &sink) {
+PartitionGlobalMergeStates::PartitionGlobalMergeStates(PartitionGlobalSinkState &sink, const vector<bool> &bins) {
 	// Schedule all the sorts for maximum thread utilisation
 	if (sink.grouping_data) {
 		auto &partitions = sink.grouping_data->GetPartitions();
 		sink.bin_groups.resize(partitions.size(), partitions.size());
+		D_ASSERT(bins.empty() || bins.size() == partitions.size());
 		for (hash_t hash_bin = 0; hash_bin < partitions.size(); ++hash_bin) {
+			if (!bins.empty() && !bins[hash_bin]) {
+				continue;
+			}
 			auto &group_data = partitions[hash_bin];
 			// Prepare for merge sort phase
 			if (group_data->Count()) {
@@ -1,11 +1,26 @@
 #include "duckdb/common/fast_mem.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/sort/comparators.hpp"
-#include "duckdb/common/sort/duckdb_pdqsort.hpp"
 #include "duckdb/common/sort/sort.hpp"
 
 namespace duckdb {
 
+//! Compares two blob values - string comparisons are inlined, so that we do not dispatch on the type per comparison
+template <bool IS_STRING>
+static inline int CompareTiedBlobs(const data_ptr_t l_ptr, const data_ptr_t r_ptr, const LogicalType &type) {
+	if (!IS_STRING) {
+		return Comparators::CompareVal(l_ptr, r_ptr, type);
+	}
+	const auto l_val = Load<string_t>(l_ptr);
+	const auto r_val = Load<string_t>(r_ptr);
+	if (Equals::Operation<string_t>(l_val, r_val)) {
+		return 0;
+	}
+	return LessThan::Operation<string_t>(l_val, r_val) ? -1 : 1;
+}
+
 //! Calls std::sort on strings that are tied by their prefix after the radix sort
+template <bool IS_STRING>
 static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &start, const idx_t &end,
                           const idx_t &tie_col, bool *ties, const data_ptr_t blob_ptr, const SortLayout &sort_layout) {
 	const auto row_width = sort_layout.blob_layout.GetRowWidth();
@@ -35,7 +50,7 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 		          idx_t right_idx = Load<uint32_t>(r + sort_layout.comparison_size);
 		          data_ptr_t left_ptr = blob_ptr + left_idx * row_width + tie_col_offset;
 		          data_ptr_t right_ptr = blob_ptr + right_idx * row_width + tie_col_offset;
-		          return order * Comparators::CompareVal(left_ptr, right_ptr, logical_type) < 0;
+		          return order * CompareTiedBlobs<IS_STRING>(left_ptr, right_ptr, logical_type) < 0;
 	          });
 	// Re-order
 	auto temp_block = buffer_manager.GetBufferAllocator().Allocate((end - start) * sort_layout.entry_size);
@@ -54,7 +69,7 @@ static void SortTiedBlobs(BufferManager &buffer_manager, const data_ptr_t datapt
 			// Load next entry and compare
 			idx_ptr += sort_layout.entry_size;
 			data_ptr_t next_ptr = blob_ptr + Load<uint32_t>(idx_ptr) * row_width + tie_col_offset;
-			ties[start + i] = Comparators::CompareVal(current_ptr, next_ptr, logical_type) == 0;
+			ties[start + i] = CompareTiedBlobs<IS_STRING>(current_ptr, next_ptr, logical_type) == 0;
 			current_ptr = next_ptr;
 		}
 	}
@@ -67,6 +82,8 @@ static void SortTiedBlobs(BufferManager &buffer_manager, SortedBlock &sb, bool *
 	auto &blob_block = *sb.blob_sorting_data->data_blocks.back();
 	auto blob_handle = buffer_manager.Pin(blob_block.block);
 	const data_ptr_t blob_ptr = blob_handle.Ptr();
+	const auto &col_idx = sort_layout.sorting_to_blob_col.at(tie_col);
+	const bool is_string = sort_layout.blob_layout.GetTypes()[col_idx].InternalType() == PhysicalType::VARCHAR;
 
 	for (idx_t i = 0; i < count; i++) {
 		if (!ties[i]) {
@@ -78,7 +95,11 @@ static void SortTiedBlobs(BufferManager &buffer_manager, SortedBlock &sb, bool *
 				break;
 			}
 		}
-		SortTiedBlobs(buffer_manager, dataptr, i, j + 1, tie_col, ties, blob_ptr, sort_layout);
+		if (is_string) {
+			SortTiedBlobs<true>(buffer_manager, dataptr, i, j + 1, tie_col, ties, blob_ptr, sort_layout);
+		} else {
+			SortTiedBlobs<false>(buffer_manager, dataptr, i, j + 1, tie_col, ties, blob_ptr, sort_layout);
+		}
 		i = j;
 	}
 }
@@ -106,39 +127,71 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	}
 }
 
-//! Textbook LSD radix sort
+//! Collects the counts of the radix at the given offset of each row
+static void ComputeHistogram(data_ptr_t offset_ptr, const idx_t &count, const idx_t &row_width, idx_t counts[]) {
+	// Count into interleaved histograms, so that runs of equal radixes do not serialize on the same counter
+	static constexpr idx_t HISTOGRAM_COUNT = 4;
+	idx_t histograms[HISTOGRAM_COUNT][SortConstants::VALUES_PER_RADIX];
+	memset(histograms, 0, sizeof(histograms));
+	idx_t i = 0;
+	for (; i + HISTOGRAM_COUNT <= count; i += HISTOGRAM_COUNT) {
+		for (idx_t h = 0; h < HISTOGRAM_COUNT; h++) {
+			histograms[h][*offset_ptr]++;
+			offset_ptr += row_width;
+		}
+	}
+	for (; i < count; i++) {
+		histograms[0][*offset_ptr]++;
+		offset_ptr += row_width;
+	}
+	for (idx_t radix = 0; radix < SortConstants::VALUES_PER_RADIX; radix++) {
+		counts[radix] = 0;
+		for (idx_t h = 0; h < HISTOGRAM_COUNT; h++) {
+			counts[radix] += histograms[h][radix];
+		}
+	}
+}
+
+//! LSD radix sort that collects the counts of all radixes in a single pass over the data
 void RadixSortLSD(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
                   const idx_t &row_width, const idx_t &sorting_size) {
-	auto temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
-	bool swap = false;
+	D_ASSERT(sorting_size <= SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD);
+	// Collect the counts of all radixes at once, instead of re-reading the data before each pass
+	idx_t counts[SortConstants::MSD_RADIX_SORT_SIZE_THRESHOLD][SortConstants::VALUES_PER_RADIX];
+	memset(counts, 0, sizeof(counts));
+	data_ptr_t row_ptr = dataptr + col_offset;
+	for (idx_t i = 0; i < count; i++) {
+		for (idx_t r = 0; r < sorting_size; r++) {
+			counts[r][row_ptr[r]]++;
+		}
+		row_ptr += row_width;
+	}
 
-	idx_t counts[SortConstants::VALUES_PER_RADIX];
+	AllocatedData temp_block;
+	bool swap = false;
 	for (idx_t r = 1; r <= sorting_size; r++) {
-		// Init counts to 0
-		memset(counts, 0, sizeof(counts));
-		// Const some values for convenience
-		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
-		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		const idx_t offset = col_offset + sorting_size - r;
-		// Collect counts
-		data_ptr_t offset_ptr = source_ptr + offset;
-		for (idx_t i = 0; i < count; i++) {
-			counts[*offset_ptr]++;
-			offset_ptr += row_width;
-		}
+		auto &radix_counts = counts[sorting_size - r];
 		// Compute offsets from counts
-		idx_t max_count = counts[0];
+		idx_t max_count = radix_counts[0];
 		for (idx_t val = 1; val < SortConstants::VALUES_PER_RADIX; val++) {
-			max_count = MaxValue<idx_t>(max_count, counts[val]);
-			counts[val] = counts[val] + counts[val - 1];
+			max_count = MaxValue<idx_t>(max_count, radix_counts[val]);
+			radix_counts[val] = radix_counts[val] + radix_counts[val - 1];
 		}
 		if (max_count == count) {
+			// All rows have the same radix, this pass would not change the order
 			continue;
 		}
+		if (!temp_block.get()) {
+			temp_block = buffer_manager.GetBufferAllocator().Allocate(count * row_width);
+		}
+		// Const some values for convenience
+		const data_ptr_t source_ptr = swap ? temp_block.get() : dataptr;
+		const data_ptr_t target_ptr = swap ? dataptr : temp_block.get();
 		// Re-order the data in temporary array
-		data_ptr_t row_ptr = source_ptr + (count - 1) * row_width;
+		row_ptr = source_ptr + (count - 1) * row_width;
 		for (idx_t i = 0; i < count; i++) {
-			idx_t &radix_offset = --counts[*(row_ptr + offset)];
+			idx_t &radix_offset = --radix_counts[*(row_ptr + offset)];
 			FastMemcpy(target_ptr + radix_offset * row_width, row_ptr, row_width);
 			row_ptr -= row_width;
 		}
@@ -182,16 +235,12 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
                   const idx_t &row_width, const idx_t &comp_width, const idx_t &offset, idx_t locations[], bool swap) {
 	const data_ptr_t source_ptr = swap ? temp_ptr : orig_ptr;
 	const data_ptr_t target_ptr = swap ? orig_ptr : temp_ptr;
-	// Init counts to 0
-	memset(locations, 0, SortConstants::MSD_RADIX_LOCATIONS * sizeof(idx_t));
+	// The counts are stored after the first location, which is 0
+	locations[0] = 0;
 	idx_t *counts = locations + 1;
 	// Collect counts
 	const idx_t total_offset = col_offset + offset;
-	data_ptr_t offset_ptr = source_ptr + total_offset;
-	for (idx_t i = 0; i < count; i++) {
-		counts[*offset_ptr]++;
-		offset_ptr += row_width;
-	}
+	ComputeHistogram(source_ptr + total_offset, count, row_width, counts);
 	// Compute locations from counts
 	idx_t max_count = 0;
 	for (idx_t radix = 0; radix < SortConstants::VALUES_PER_RADIX; radix++) {
@@ -236,16 +285,9 @@ void RadixSortMSD(const data_ptr_t orig_ptr, const data_ptr_t temp_ptr, const id
 }
 
 //! Calls different sort functions, depending on the count and sorting sizes
+//! String prefixes are normalized to fixed-size keys as well, so they are radix sorted like any other key
 void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const idx_t &count, const idx_t &col_offset,
-               const idx_t &sorting_size, const SortLayout &sort_layout, bool contains_string) {
-
-	if (contains_string) {
-		auto begin = duckdb_pdqsort::PDQIterator(dataptr, sort_layout.entry_size);
-		auto end = begin + count;
-		duckdb_pdqsort::PDQConstants constants(sort_layout.entry_size, col_offset, sorting_size, *end);
-		return duckdb_pdqsort::pdqsort_branchless(begin, begin + count, constants);
-	}
-
+               const idx_t &sorting_size, const SortLayout &sort_layout) {
 	if (count <= SortConstants::INSERTION_SORT_THRESHOLD) {
 		return InsertionSort(dataptr, nullptr, count, col_offset, sort_layout.entry_size, sorting_size, 0, false);
 	}
@@ -266,7 +308,7 @@ void RadixSort(BufferManager &buffer_manager, const data_ptr_t &dataptr, const i
 //! Identifies sequences of rows that are tied, and calls radix sort on these
 static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &count,
                               const idx_t &col_offset, const idx_t &sorting_size, bool ties[],
-                              const SortLayout &sort_layout, bool contains_string) {
+                              const SortLayout &sort_layout) {
 	D_ASSERT(!ties[count - 1]);
 	for (idx_t i = 0; i < count; i++) {
 		if (!ties[i]) {
@@ -279,7 +321,7 @@ static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t da
 			}
 		}
 		RadixSort(buffer_manager, dataptr + i * sort_layout.entry_size, j - i + 1, col_offset, sorting_size,
-		          sort_layout, contains_string);
+		          sort_layout);
 		i = j;
 	}
 }
@@ -301,10 +343,8 @@ void LocalSortState::SortInMemory() {
 	idx_t col_offset = 0;
 	unsafe_unique_array<bool> ties_ptr;
 	bool *ties = nullptr;
-	bool contains_string = false;
 	for (idx_t i = 0; i < sort_layout->column_count; i++) {
 		sorting_size += sort_layout->column_sizes[i];
-		contains_string = contains_string || sort_layout->logical_types[i].InternalType() == PhysicalType::VARCHAR;
 		if (sort_layout->constant_size[i] && i < sort_layout->column_count - 1) {
 			// Add columns to the sorting size until we reach a variable size column, or the last column
 			continue;
@@ -312,19 +352,16 @@ void LocalSortState::SortInMemory() {
 
 		if (!ties) {
 			// This is the first sort
-			RadixSort(*buffer_manager, dataptr, count, col_offset, sorting_size, *sort_layout, contains_string);
+			RadixSort(*buffer_manager, dataptr, count, col_offset, sorting_size, *sort_layout);
 			ties_ptr = make_unsafe_uniq_array_uninitialized<bool>(count);
 			ties = ties_ptr.get();
 			std::fill_n(ties, count - 1, true);
 			ties[count - 1] = false;
 		} else {
 			// For subsequent sorts, we only have to subsort the tied tuples
-			SubSortTiedTuples(*buffer_manager, dataptr, count, col_offset, sorting_size, ties, *sort_layout,
-			                  contains_string);
+			SubSortTiedTuples(*buffer_manager, dataptr, count, col_offset, sorting_size, ties, *sort_layout);
 		}
 
-		contains_string = false;
-
 		if (sort_layout->constant_size[i] && i == sort_layout->column_count - 1) {
 			// All columns are sorted, no ties to break because last column is constant size
 			break;
@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -366,7 +367,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), group_idx(0) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -432,23 +433,51 @@ void GlobalSortState::PrepareMergePhase() {
 	}
 }
 
+//! The number of sorted blocks that are merged by a single k-way merge
+static idx_t GetMergeFanIn(GlobalSortState &state) {
+	// Every reader pins its current radix, blob and payload blocks, so the fan-in is bounded by the memory per thread
+	auto &buffer_manager = state.buffer_manager;
+	auto &scheduler = TaskScheduler::GetScheduler(buffer_manager.GetDatabase());
+	const auto num_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	const auto thread_memory = buffer_manager.GetQueryMaxMemory() / num_threads / 4;
+
+	auto row_width = state.sort_layout.entry_size + state.payload_layout.GetRowWidth();
+	if (!state.sort_layout.all_constant) {
+		row_width += state.sort_layout.blob_layout.GetRowWidth();
+	}
+	auto reader_size = state.block_capacity * row_width;
+	if (state.external) {
+		// Swizzled heap blocks are pinned as well
+		reader_size += 2 * buffer_manager.GetBlockSize();
+	}
+	const auto fan_in = thread_memory / MaxValue<idx_t>(reader_size, 1);
+	return MinValue<idx_t>(MaxValue<idx_t>(fan_in, 2), SortConstants::MERGE_FAN_IN);
+}
+
 void GlobalSortState::InitializeMergeRound() {
 	D_ASSERT(sorted_blocks_temp.empty());
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
-		odd_one_out = std::move(sorted_blocks.back());
-		sorted_blocks.pop_back();
+	// Divide the blocks into as few groups as possible, and balance the number of blocks per group
+	const auto block_count = sorted_blocks.size();
+	const auto fan_in = GetMergeFanIn(*this);
+	const auto group_count = (block_count + fan_in - 1) / fan_in;
+	group_offsets.clear();
+	group_offsets.push_back(0);
+	for (idx_t g_idx = 0; g_idx < group_count; g_idx++) {
+		const auto group_size = block_count / group_count + (g_idx < block_count % group_count ? 1 : 0);
+		group_offsets.push_back(group_offsets.back() + group_size);
 	}
+	D_ASSERT(group_offsets.back() == block_count);
 	// Init merge path path indices
-	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
-	l_start = 0;
-	r_start = 0;
+	group_idx = 0;
+	run_starts.clear();
+	if (group_count > 0) {
+		run_starts.resize(GroupSize(0), 0);
+	}
 	// Allocate room for merge results
-	for (idx_t p_idx = 0; p_idx < num_pairs; p_idx++) {
+	for (idx_t g_idx = 0; g_idx < group_count; g_idx++) {
 		sorted_blocks_temp.emplace_back();
 	}
 }
@@ -460,10 +489,7 @@ void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 		sorted_blocks.back()->AppendSortedBlocks(sorted_block_vector);
 	}
 	sorted_blocks_temp.clear();
-	if (odd_one_out) {
-		sorted_blocks.push_back(std::move(odd_one_out));
-		odd_one_out = nullptr;
-	}
+	group_offsets.clear();
 	// Only one block left: Done!
 	if (sorted_blocks.size() == 1 && !keep_radix_data) {
 		sorted_blocks[0]->radix_sorting_data.clear();
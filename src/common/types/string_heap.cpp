@@ -20,6 +20,10 @@ void StringHeap::Move(StringHeap &other) {
 	other.allocator.Move(allocator);
 }
 
+void StringHeap::Reset() {
+	allocator.Reset();
+}
+
 string_t StringHeap::AddString(const char *data, idx_t len) {
 	D_ASSERT(Utf8Proc::Analyze(data, len) != UnicodeType::INVALID);
 	return AddBlob(data, len);
@@ -29,6 +29,17 @@ VectorStringBuffer::VectorStringBuffer() : VectorBuffer(VectorBufferType::STRING
 VectorStringBuffer::VectorStringBuffer(VectorBufferType type) : VectorBuffer(type) {
 }
 
+bool VectorStringBuffer::TryReset() {
+	if (GetBufferType() != VectorBufferType::STRING_BUFFER || heap.AllocationSize() > MAXIMUM_REUSE_SIZE) {
+		// don't hold on to large heaps, or to specialized string buffers
+		return false;
+	}
+	heap.Reset();
+	references.clear();
+	SetAuxiliaryData(nullptr);
+	return true;
+}
+
 VectorFSSTStringBuffer::VectorFSSTStringBuffer() : VectorStringBuffer(VectorBufferType::FSST_BUFFER) {
 }
 
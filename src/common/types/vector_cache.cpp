@@ -93,6 +93,17 @@ public:
 			}
 			break;
 		}
+		case PhysicalType::VARCHAR:
+			result.data = owned_data.get();
+			// if no other vector references the string buffer of the previous chunk we reuse it: the strings of the
+			// next chunk are then bump-allocated into its heap instead of allocating and freeing a heap per chunk
+			if (result.auxiliary && result.auxiliary.use_count() == 1 &&
+			    result.auxiliary->GetBufferType() == VectorBufferType::STRING_BUFFER &&
+			    result.auxiliary->Cast<VectorStringBuffer>().TryReset()) {
+				break;
+			}
+			result.auxiliary.reset();
+			break;
 		default:
 			// regular type: no aux data and reset data to cached data
 			result.data = owned_data.get();
@@ -54,6 +54,14 @@ void VirtualFileSystem::Write(FileHandle &handle, void *buffer, int64_t nr_bytes
 	handle.file_system.Write(handle, buffer, nr_bytes, location);
 }
 
+void VirtualFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	handle.file_system.ReadBatch(handle, requests);
+}
+
+unique_ptr<FileMemoryMapping> VirtualFileSystem::MapFile(FileHandle &handle, idx_t size) {
+	return handle.file_system.MapFile(handle, size);
+}
+
 int64_t VirtualFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	return handle.file_system.Read(handle, buffer, nr_bytes);
 }
@@ -41,7 +41,9 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), capacity(0),
+      aggregate_allocator(
+          make_shared_ptr<ArenaAllocator>(BufferAllocator::Get(context, MemoryTag::AGGREGATE_STATE))) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -175,6 +177,7 @@ void GroupedAggregateHashTable::Resize(idx_t size) {
 
 	capacity = size;
 	hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
+	buffer_manager.AdviseHugePages(MemoryTag::HASH_TABLE, hash_map.get(), hash_map.GetSize());
 	entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 	ClearPointerTable();
 	bitmask = capacity - 1;
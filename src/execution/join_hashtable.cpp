@@ -689,6 +689,7 @@ void JoinHashTable::InitializePointerTable() {
 		if (capacity > current_capacity) {
 			// Need more space
 			hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
+			buffer_manager.AdviseHugePages(MemoryTag::HASH_TABLE, hash_map.get(), hash_map.GetSize());
 			entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 		} else {
 			// Just use the current hash map
@@ -697,6 +698,7 @@ void JoinHashTable::InitializePointerTable() {
 	} else {
 		// Allocate a hash map
 		hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
+		buffer_manager.AdviseHugePages(MemoryTag::HASH_TABLE, hash_map.get(), hash_map.GetSize());
 		entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 	}
 	D_ASSERT(hash_map.GetSize() == capacity * sizeof(ht_entry_t));
@@ -26,10 +26,54 @@ public:
 class StreamingWindowState : public OperatorState {
 public:
 	struct AggregateState {
+		//	The largest number of preceding rows of a streamed ROWS frame
+		static constexpr idx_t MAX_FRAME = 2048U;
+
+		static bool ComputePreceding(ClientContext &context, BoundWindowExpression &wexpr, idx_t &preceding) {
+			//	We can only remove rows from the frame by rebuilding the combined states
+			if (wexpr.end != WindowBoundary::CURRENT_ROW_ROWS || wexpr.distinct || wexpr.children.empty() ||
+			    !wexpr.aggregate->combine) {
+				return false;
+			}
+			//	Holistic aggregates and states that own variable size data make every combine as expensive as
+			//	the frame, so the blocking window (with its window callback or segment tree) is faster for them
+			if (wexpr.aggregate->window || wexpr.aggregate->destructor) {
+				return false;
+			}
+			switch (wexpr.start) {
+			case WindowBoundary::CURRENT_ROW_ROWS:
+				preceding = 0;
+				return true;
+			case WindowBoundary::EXPR_PRECEDING_ROWS:
+				break;
+			default:
+				return false;
+			}
+			if (wexpr.start_expr->HasParameter() || !wexpr.start_expr->IsFoldable()) {
+				return false;
+			}
+			auto start_value = ExpressionExecutor::EvaluateScalar(context, *wexpr.start_expr);
+			if (start_value.IsNull()) {
+				return false;
+			}
+			Value bigint_value;
+			if (!start_value.DefaultTryCastAs(LogicalType::BIGINT, bigint_value, nullptr, false)) {
+				return false;
+			}
+			//	Negative offsets are reported by the blocking window
+			const auto offset = bigint_value.GetValue<int64_t>();
+			if (offset < 0 || idx_t(offset) >= MAX_FRAME) {
+				return false;
+			}
+			preceding = idx_t(offset);
+			return true;
+		}
+
 		AggregateState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator)
 		    : wexpr(wexpr), arena_allocator(Allocator::DefaultAllocator()), executor(client), filter_executor(client),
 		      statev(LogicalType::POINTER, data_ptr_cast(&state_ptr)), hashes(LogicalType::HASH),
-		      addresses(LogicalType::POINTER) {
+		      addresses(LogicalType::POINTER), sourcev(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+		      front_statev(LogicalType::POINTER) {
 			D_ASSERT(wexpr.GetExpressionType() == ExpressionType::WINDOW_AGGREGATE);
 			auto &aggregate = *wexpr.aggregate;
 			bind_data = wexpr.bind_info.get();
@@ -54,6 +98,10 @@ public:
 				distinct_args.Initialize(allocator, arg_types);
 				distinct_sel.Initialize();
 			}
+			idx_t preceding;
+			if (ComputePreceding(client, wexpr, preceding)) {
+				InitializeFrame(allocator, preceding + 1);
+			}
 		}
 
 		~AggregateState() {
@@ -61,11 +109,53 @@ public:
 				AggregateInputData aggr_input_data(bind_data, arena_allocator);
 				state_ptr = state.data();
 				dtor(statev, aggr_input_data, 1);
+				if (frame_size) {
+					DestroyState(back_state.data(), aggr_input_data);
+					for (; front_begin < front_end; ++front_begin) {
+						DestroyState(GetFrontState(front_begin), aggr_input_data);
+					}
+				}
 			}
 		}
 
 		void Execute(ExecutionContext &context, DataChunk &input, Vector &result);
 
+		//! Sets up the states for a frame of a bounded number of preceding rows
+		void InitializeFrame(Allocator &allocator, idx_t frame_size_p) {
+			auto &aggregate = *wexpr.aggregate;
+			frame_size = frame_size_p;
+			state_size = aggregate.state_size(aggregate);
+			back_state.resize(state_size);
+			aggregate.initialize(aggregate, back_state.data());
+			front_states.resize(state_size * frame_size);
+			frame_state.resize(state_size);
+
+			const auto frame_capacity = frame_size + STANDARD_VECTOR_SIZE;
+			for (auto &args : frame_args) {
+				args.Initialize(allocator, arg_types, frame_capacity);
+			}
+			frame_filter.resize(frame_capacity);
+			front_args.Initialize(allocator, arg_types);
+			front_sel.Initialize();
+		}
+
+		data_ptr_t GetFrontState(idx_t front_idx) {
+			return front_states.data() + front_idx * state_size;
+		}
+
+		void DestroyState(data_ptr_t state_p, AggregateInputData &aggr_input_data) {
+			if (dtor) {
+				state_ptr = state_p;
+				dtor(statev, aggr_input_data, 1);
+			}
+		}
+
+		//! Moves the rows of the back state to the front states
+		void FlipFrame(AggregateInputData &aggr_input_data);
+		//! Computes the aggregate of a bounded number of preceding rows
+		void ExecuteFrame(const ValidityMask &filter_mask, SelectionVector &sel, const vector<column_t> &structs,
+		                  Vector &result);
+
 		//! The aggregate expression
 		BoundWindowExpression &wexpr;
 		//! The allocator to use for aggregate data structures
@@ -105,6 +195,42 @@ public:
 		SelectionVector distinct_sel;
 		//! Pointers to groups in the hash table.
 		Vector addresses;
+
+		//	Frames of a bounded number of preceding rows are evaluated with two stacks:
+		//	the rows entering the frame are aggregated into the back state, while the front states hold
+		//	the suffix aggregates of older rows, which are popped as the rows leave the frame.
+		//	When the front runs empty, the rows of the back state are flipped into it.
+
+		//! The number of rows in a full frame (zero for unbounded frames)
+		idx_t frame_size = 0;
+		//! The size of a single aggregate state
+		idx_t state_size = 0;
+		//! The arguments of the rows in the back state (double buffered to compact them)
+		DataChunk frame_args[2];
+		//! The buffer that holds the current arguments
+		idx_t frame_curr = 0;
+		//! Whether the buffered rows pass the FILTER
+		vector<bool> frame_filter;
+		//! The first buffered row of the back state
+		idx_t back_begin = 0;
+		//! The number of rows in the back state
+		idx_t back_count = 0;
+		//! The aggregate of the rows in the back state
+		vector<data_t> back_state;
+		//! The suffix aggregates of the rows in the front
+		vector<data_t> front_states;
+		//! The range of front states that are still in the frame
+		idx_t front_begin = 0;
+		idx_t front_end = 0;
+		//! The state that combines the front and back states of a frame
+		vector<data_t> frame_state;
+		//! The source state for combining single states
+		data_ptr_t source_ptr = nullptr;
+		Vector sourcev;
+		//! The states and arguments for building the front states
+		Vector front_statev;
+		DataChunk front_args;
+		SelectionVector front_sel;
 	};
 
 	struct LeadLagState {
@@ -338,9 +464,15 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 	}
 	switch (wexpr.type) {
 	// TODO: add more expression types here?
-	case ExpressionType::WINDOW_AGGREGATE:
+	case ExpressionType::WINDOW_AGGREGATE: {
 		// We can stream aggregates if they are "running totals"
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+			return true;
+		}
+		// or if they only aggregate a bounded number of preceding rows
+		idx_t preceding;
+		return StreamingWindowState::AggregateState::ComputePreceding(context, wexpr, preceding);
+	}
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -456,6 +588,11 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 		}
 	}
 
+	if (frame_size) {
+		ExecuteFrame(filter_mask, sel, structs, result);
+		return;
+	}
+
 	// Update the state and finalize it one row at a time.
 	AggregateInputData aggr_input_data(wexpr.bind_info.get(), aggr_state.arena_allocator);
 	for (idx_t i = 0; i < count; ++i) {
@@ -470,6 +607,113 @@ void StreamingWindowState::AggregateState::Execute(ExecutionContext &context, Da
 	}
 }
 
+void StreamingWindowState::AggregateState::FlipFrame(AggregateInputData &aggr_input_data) {
+	D_ASSERT(front_begin == front_end);
+	auto &aggregate = *wexpr.aggregate;
+	auto &frame_chunk = frame_args[frame_curr];
+	const auto flip_count = back_count;
+
+	//	Aggregate each row into its own front state
+	for (idx_t front_idx = 0; front_idx < flip_count; ++front_idx) {
+		aggregate.initialize(aggregate, GetFrontState(front_idx));
+	}
+	auto front_ptrs = FlatVector::GetData<data_ptr_t>(front_statev);
+	for (idx_t base = 0; base < flip_count; base += STANDARD_VECTOR_SIZE) {
+		const auto limit = MinValue<idx_t>(flip_count, base + STANDARD_VECTOR_SIZE);
+		idx_t updates = 0;
+		for (idx_t front_idx = base; front_idx < limit; ++front_idx) {
+			const auto row_idx = back_begin + front_idx;
+			if (frame_filter[row_idx]) {
+				front_ptrs[updates] = GetFrontState(front_idx);
+				front_sel.set_index(updates++, row_idx);
+			}
+		}
+		if (updates) {
+			front_args.Slice(frame_chunk, front_sel, updates);
+			aggregate.update(front_args.data.data(), aggr_input_data, front_args.ColumnCount(), front_statev, updates);
+		}
+	}
+
+	//	Turn them into suffix aggregates from right to left
+	for (idx_t front_idx = flip_count; front_idx-- > 1;) {
+		source_ptr = GetFrontState(front_idx);
+		state_ptr = GetFrontState(front_idx - 1);
+		aggregate.combine(sourcev, statev, aggr_input_data, 1);
+	}
+	front_begin = 0;
+	front_end = flip_count;
+
+	//	Restart the back state
+	DestroyState(back_state.data(), aggr_input_data);
+	aggregate.initialize(aggregate, back_state.data());
+	back_begin += flip_count;
+	back_count = 0;
+}
+
+void StreamingWindowState::AggregateState::ExecuteFrame(const ValidityMask &filter_mask, SelectionVector &sel,
+                                                        const vector<column_t> &structs, Vector &result) {
+	auto &aggregate = *wexpr.aggregate;
+	const auto count = arg_chunk.size();
+
+	//	Move the arguments of the back state and the new rows into the other buffer,
+	//	which keeps the buffered arguments (and their strings) bounded by the frame size.
+	auto &prev_args = frame_args[frame_curr];
+	frame_curr = 1 - frame_curr;
+	auto &frame_chunk = frame_args[frame_curr];
+	frame_chunk.Reset();
+	frame_chunk.SetCapacity(frame_size + STANDARD_VECTOR_SIZE);
+	for (column_t col_idx = 0; col_idx < frame_chunk.ColumnCount(); ++col_idx) {
+		auto &target = frame_chunk.data[col_idx];
+		VectorOperations::Copy(prev_args.data[col_idx], target, back_begin + back_count, back_begin, 0);
+		VectorOperations::Copy(arg_chunk.data[col_idx], target, count, 0, back_count);
+	}
+	frame_chunk.SetCardinality(back_count + count);
+	for (idx_t row_idx = 0; row_idx < back_count; ++row_idx) {
+		frame_filter[row_idx] = frame_filter[back_begin + row_idx];
+	}
+	for (idx_t i = 0; i < count; ++i) {
+		frame_filter[back_count + i] = filter_mask.RowIsValid(i);
+	}
+	back_begin = 0;
+
+	AggregateInputData aggr_input_data(wexpr.bind_info.get(), arena_allocator);
+	for (idx_t i = 0; i < count; ++i) {
+		//	Remove the oldest row from a full frame
+		if (front_end - front_begin + back_count == frame_size) {
+			if (front_begin == front_end) {
+				FlipFrame(aggr_input_data);
+			}
+			DestroyState(GetFrontState(front_begin++), aggr_input_data);
+		}
+
+		//	Add the new row to the back state
+		if (filter_mask.RowIsValid(i)) {
+			sel.set_index(0, i);
+			for (const auto struct_idx : structs) {
+				arg_cursor.data[struct_idx].Slice(arg_chunk.data[struct_idx], sel, 1);
+			}
+			state_ptr = back_state.data();
+			aggregate.update(arg_cursor.data.data(), aggr_input_data, arg_cursor.ColumnCount(), statev, 1);
+		}
+		++back_count;
+
+		//	The frame is the oldest front state followed by the back state
+		if (front_begin == front_end) {
+			state_ptr = back_state.data();
+			aggregate.finalize(statev, aggr_input_data, result, 1, i);
+			continue;
+		}
+		state_ptr = frame_state.data();
+		aggregate.initialize(aggregate, state_ptr);
+		source_ptr = GetFrontState(front_begin);
+		aggregate.combine(sourcev, statev, aggr_input_data, 1);
+		source_ptr = back_state.data();
+		aggregate.combine(sourcev, statev, aggr_input_data, 1);
+		aggregate.finalize(statev, aggr_input_data, result, 1, i);
+		DestroyState(frame_state.data(), aggr_input_data);
+	}
+}
+
 void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataChunk &chunk, DataChunk &delayed,
                                                GlobalOperatorState &gstate_p, OperatorState &state_p) const {
 	auto &gstate = gstate_p.Cast<StreamingWindowGlobalState>();
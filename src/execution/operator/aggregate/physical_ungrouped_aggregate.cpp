@@ -80,7 +80,7 @@ void UngroupedAggregateState::Move(UngroupedAggregateState &other) {
 class UngroupedAggregateGlobalSinkState : public GlobalSinkState {
 public:
 	UngroupedAggregateGlobalSinkState(const PhysicalUngroupedAggregate &op, ClientContext &client)
-	    : state(BufferAllocator::Get(client), op.aggregates), finished(false) {
+	    : state(BufferAllocator::Get(client, MemoryTag::AGGREGATE_STATE), op.aggregates), finished(false) {
 		if (op.distinct_data) {
 			distinct_state = make_uniq<DistinctAggregateState>(*op.distinct_data, client);
 		}
@@ -4,6 +4,7 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
@@ -32,7 +33,7 @@ namespace duckdb {
 //	Global sink state
 class WindowGlobalSinkState;
 
-enum WindowGroupStage : uint8_t { SINK, FINALIZE, GETDATA, DONE };
+enum WindowGroupStage : uint8_t { MASK, SINK, FINALIZE, GETDATA, DONE };
 
 class WindowHashGroup {
 public:
@@ -48,6 +49,11 @@ public:
 
 	ExecutorGlobalStates &Initialize(WindowGlobalSinkState &gstate);
 
+	//! Compute the partition and order boundaries of the rows in a range of blocks
+	void ComputeMasks(idx_t begin_idx, idx_t end_idx);
+	//! Free up the sort keys once the masks have been computed
+	void FreeSortKeys();
+
 	// Scan all of the blocks during the build phase
 	unique_ptr<RowDataCollectionScanner> GetBuildScanner(idx_t block_idx) const {
 		if (!rows) {
@@ -71,6 +77,13 @@ public:
 	bool TryPrepareNextStage() {
 		lock_guard<mutex> prepare_guard(lock);
 		switch (stage.load()) {
+		case WindowGroupStage::MASK:
+			if (masked == blocks) {
+				FreeSortKeys();
+				stage = WindowGroupStage::SINK;
+				return true;
+			}
+			return false;
 		case WindowGroupStage::SINK:
 			if (sunk == count) {
 				stage = WindowGroupStage::FINALIZE;
@@ -95,6 +108,8 @@ public:
 	idx_t count = 0;
 	//! The number of blocks in the group
 	idx_t blocks = 0;
+	//! The first row of each block, plus the total count
+	vector<idx_t> block_starts;
 	unique_ptr<RowDataCollection> rows;
 	unique_ptr<RowDataCollection> heap;
 	RowLayout layout;
@@ -115,6 +130,8 @@ public:
 	idx_t hash_bin;
 	//! Single threading lock
 	mutex lock;
+	//! Count of masked blocks
+	std::atomic<idx_t> masked;
 	//! Count of sunk rows
 	std::atomic<idx_t> sunk;
 	//! Count of finalized blocks
@@ -130,6 +147,17 @@ private:
 
 class WindowPartitionGlobalSinkState;
 
+//! The executor result that holds a window result column
+struct WindowResultColumn {
+	WindowResultColumn(idx_t executor_idx, optional_idx entry_idx) : executor_idx(executor_idx), entry_idx(entry_idx) {
+	}
+
+	//! The executor that computes the column
+	idx_t executor_idx;
+	//! The STRUCT entry of the column, if the executor evaluates several aggregates together
+	optional_idx entry_idx;
+};
+
 class WindowGlobalSinkState : public GlobalSinkState {
 public:
 	using ExecutorPtr = unique_ptr<WindowExecutor>;
@@ -145,6 +173,10 @@ public:
 	unique_ptr<WindowPartitionGlobalSinkState> global_partition;
 	//! The execution functions
 	Executors executors;
+	//! The combined window expressions of the aggregates that are evaluated together
+	vector<unique_ptr<BoundWindowExpression>> shared_aggregates;
+	//! The executor result of each window expression
+	vector<WindowResultColumn> result_columns;
 };
 
 class WindowPartitionGlobalSinkState : public PartitionGlobalSinkState {
@@ -253,11 +285,45 @@ WindowGlobalSinkState::WindowGlobalSinkState(const PhysicalWindow &op, ClientCon
 	auto &wexpr = op.select_list[op.order_idx]->Cast<BoundWindowExpression>();
 
 	const auto mode = DBConfig::GetConfig(context).options.window_mode;
-	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
+	const auto expr_count = op.select_list.size();
+	vector<bool> shared(expr_count, false);
+	result_columns.resize(expr_count, WindowResultColumn(0, optional_idx()));
+	for (idx_t expr_idx = 0; expr_idx < expr_count; ++expr_idx) {
 		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
 		auto &wexpr = op.select_list[expr_idx]->Cast<BoundWindowExpression>();
-		auto wexec = WindowExecutorFactory(wexpr, context, mode);
-		executors.emplace_back(std::move(wexec));
+		if (shared[expr_idx]) {
+			continue;
+		}
+
+		//	Aggregates over the same frames are evaluated together with a single segment tree
+		vector<idx_t> group(1, expr_idx);
+		if (WindowSharedAggregate::CanShare(wexpr, context, mode)) {
+			for (idx_t other_idx = expr_idx + 1; other_idx < expr_count; ++other_idx) {
+				auto &other = op.select_list[other_idx]->Cast<BoundWindowExpression>();
+				if (!shared[other_idx] && WindowSharedAggregate::CanShare(other, context, mode) &&
+				    WindowSharedAggregate::FramesAreShared(wexpr, other)) {
+					shared[other_idx] = true;
+					group.emplace_back(other_idx);
+				}
+			}
+		}
+
+		const auto executor_idx = executors.size();
+		if (group.size() == 1) {
+			executors.emplace_back(WindowExecutorFactory(wexpr, context, mode));
+			result_columns[expr_idx] = WindowResultColumn(executor_idx, optional_idx());
+			continue;
+		}
+
+		vector<reference<BoundWindowExpression>> wexprs;
+		for (const auto group_idx : group) {
+			wexprs.emplace_back(op.select_list[group_idx]->Cast<BoundWindowExpression>());
+		}
+		shared_aggregates.emplace_back(WindowSharedAggregate::Create(wexprs));
+		executors.emplace_back(WindowExecutorFactory(*shared_aggregates.back(), context, mode));
+		for (idx_t entry_idx = 0; entry_idx < group.size(); ++entry_idx) {
+			result_columns[group[entry_idx]] = WindowResultColumn(executor_idx, entry_idx);
+		}
 	}
 
 	global_partition = make_uniq<WindowPartitionGlobalSinkState>(*this, wexpr);
@@ -454,7 +520,8 @@ void WindowGlobalSourceState::CreateTaskList() {
 	}
 
 	//	TODO: Generate dynamically instead of building a big list?
-	vector<WindowGroupStage> states {WindowGroupStage::SINK, WindowGroupStage::FINALIZE, WindowGroupStage::GETDATA};
+	vector<WindowGroupStage> states {WindowGroupStage::MASK, WindowGroupStage::SINK, WindowGroupStage::FINALIZE,
+	                                 WindowGroupStage::GETDATA};
 	for (const auto &b : partition_blocks) {
 		auto &window_hash_group = *window_hash_groups[b.second];
 		for (const auto &state : states) {
@@ -480,11 +547,8 @@ void WindowHashGroup::MaterializeSortedData() {
 	D_ASSERT(global_sort_state.sorted_blocks.size() == 1);
 	auto &sb = *global_sort_state.sorted_blocks[0];
 
-	// Free up some memory before allocating more
-	sb.radix_sorting_data.clear();
-	sb.blob_sorting_data = nullptr;
-
 	// Move the sorting row blocks into our RDCs
+	// The sort keys are kept until the masks have been computed
 	auto &buffer_manager = global_sort_state.buffer_manager;
 	auto &sd = *sb.payload_data;
 
@@ -501,7 +565,6 @@ void WindowHashGroup::MaterializeSortedData() {
 		auto &block = sd.heap_blocks[0];
 		heap = make_uniq<RowDataCollection>(buffer_manager, block->capacity, block->entry_size);
 		heap->blocks = std::move(sd.heap_blocks);
-		hash_group.reset();
 	} else {
 		heap = make_uniq<RowDataCollection>(buffer_manager, buffer_manager.GetBlockSize(), 1U, true);
 	}
@@ -509,8 +572,27 @@ void WindowHashGroup::MaterializeSortedData() {
 	                              [&](idx_t c, const unique_ptr<RowDataBlock> &b) { return c + b->count; });
 }
 
+void WindowHashGroup::FreeSortKeys() {
+	if (!hash_group) {
+		return;
+	}
+
+	auto &global_sort_state = *hash_group->global_sort;
+	if (global_sort_state.external) {
+		//	The (swizzled) payload heap has been moved into our RDCs, so we no longer need the sort
+		hash_group.reset();
+		return;
+	}
+
+	//	In-memory payload strings still point into the heap blocks of the sort
+	for (auto &sb : global_sort_state.sorted_blocks) {
+		sb->radix_sorting_data.clear();
+		sb->blob_sorting_data = nullptr;
+	}
+}
+
 WindowHashGroup::WindowHashGroup(WindowGlobalSinkState &gstate, const idx_t hash_bin_p)
-    : count(0), blocks(0), stage(WindowGroupStage::SINK), hash_bin(hash_bin_p), sunk(0), finalized(0),
+    : count(0), blocks(0), stage(WindowGroupStage::MASK), hash_bin(hash_bin_p), masked(0), sunk(0), finalized(0),
       tasks_remaining(0), batch_base(0) {
 	// There are three types of partitions:
 	// 1. No partition (no sorting)
@@ -560,13 +642,43 @@ WindowHashGroup::WindowHashGroup(WindowGlobalSinkState &gstate, const idx_t hash
 		// Overwrite the collections with the sorted data
 		D_ASSERT(gpart.hash_groups[hash_bin].get());
 		hash_group = std::move(gpart.hash_groups[hash_bin]);
-		hash_group->ComputeMasks(partition_mask, order_masks);
 		external = hash_group->global_sort->external;
 		MaterializeSortedData();
 	}
 
 	if (rows) {
 		blocks = rows->blocks.size();
+		block_starts.reserve(blocks + 1);
+		block_starts.emplace_back(0);
+		for (const auto &block : rows->blocks) {
+			block_starts.emplace_back(block_starts.back() + block->count);
+		}
+	}
+}
+
+void WindowHashGroup::ComputeMasks(idx_t begin_idx, idx_t end_idx) {
+	if (!hash_group || begin_idx >= end_idx) {
+		return;
+	}
+
+	//	External ties between variable size keys are broken by unswizzling the keys in place,
+	//	so a single task has to scan all of them.
+	auto &global_sort = *hash_group->global_sort;
+	if (global_sort.external && !global_sort.sort_layout.all_constant) {
+		if (begin_idx) {
+			return;
+		}
+		end_idx = blocks;
+	}
+
+	//	Align the row ranges on mask entries so the tasks never write to the same entry.
+	const auto align = [](idx_t row) {
+		return row - row % ValidityMask::BITS_PER_VALUE;
+	};
+	const auto begin = align(block_starts[begin_idx]);
+	const auto end = (end_idx == blocks) ? count : align(block_starts[end_idx]);
+	if (begin < end) {
+		hash_group->ComputeMasks(partition_mask, order_masks, begin, end);
 	}
 }
 
@@ -603,6 +715,7 @@ public:
 	DataChunk output_chunk;
 
 protected:
+	void Mask();
 	void Sink();
 	void Finalize();
 	void GetData(DataChunk &chunk);
@@ -626,6 +739,17 @@ WindowHashGroup::ExecutorGlobalStates &WindowHashGroup::Initialize(WindowGlobalS
 	return gestates;
 }
 
+void WindowLocalSourceState::Mask() {
+	D_ASSERT(task);
+	D_ASSERT(task->stage == WindowGroupStage::MASK);
+
+	window_hash_group->ComputeMasks(task->begin_idx, task->end_idx);
+
+	//	Mark this range as done
+	window_hash_group->masked += (task->end_idx - task->begin_idx);
+	task->begin_idx = task->end_idx;
+}
+
 void WindowLocalSourceState::Sink() {
 	D_ASSERT(task);
 	D_ASSERT(task->stage == WindowGroupStage::SINK);
@@ -776,6 +900,10 @@ void WindowLocalSourceState::ExecuteTask(DataChunk &result) {
 
 	// Process the new state
 	switch (task->stage) {
+	case WindowGroupStage::MASK:
+		Mask();
+		D_ASSERT(TaskFinished());
+		break;
 	case WindowGroupStage::SINK:
 		Sink();
 		D_ASSERT(TaskFinished());
@@ -829,8 +957,14 @@ void WindowLocalSourceState::GetData(DataChunk &result) {
 	for (idx_t col_idx = 0; col_idx < input_chunk.ColumnCount(); col_idx++) {
 		result.data[out_idx++].Reference(input_chunk.data[col_idx]);
 	}
-	for (idx_t col_idx = 0; col_idx < output_chunk.ColumnCount(); col_idx++) {
-		result.data[out_idx++].Reference(output_chunk.data[col_idx]);
+	for (const auto &column : gsource.gsink.result_columns) {
+		auto &executor_result = output_chunk.data[column.executor_idx];
+		if (column.entry_idx.IsValid()) {
+			auto &entries = StructVector::GetEntries(executor_result);
+			result.data[out_idx++].Reference(*entries[column.entry_idx.GetIndex()]);
+		} else {
+			result.data[out_idx++].Reference(executor_result);
+		}
 	}
 
 	// If we done with this block, move to the next one
@@ -168,35 +168,13 @@ SinkFinalizeType PhysicalAsOfJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
 	}
 
-	// Schedule all the sorts for maximum thread utilisation
-	auto new_event = make_shared_ptr<PartitionMergeEvent>(gstate.rhs_sink, pipeline, *this);
-	event.InsertEvent(std::move(new_event));
-
+	// The right side is sorted in the source, once we know which partitions the left side probes.
 	return SinkFinalizeType::READY;
 }
 
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
-class AsOfGlobalState : public GlobalOperatorState {
-public:
-	explicit AsOfGlobalState(AsOfGlobalSinkState &gsink) {
-		// for FULL/RIGHT OUTER JOIN, initialize right_outers to false for every tuple
-		auto &rhs_partition = gsink.rhs_sink;
-		auto &right_outers = gsink.right_outers;
-		right_outers.reserve(rhs_partition.hash_groups.size());
-		for (const auto &hash_group : rhs_partition.hash_groups) {
-			right_outers.emplace_back(OuterJoinMarker(gsink.is_outer));
-			right_outers.back().Initialize(hash_group->count);
-		}
-	}
-};
-
-unique_ptr<GlobalOperatorState> PhysicalAsOfJoin::GetGlobalOperatorState(ClientContext &context) const {
-	auto &gsink = sink_state->Cast<AsOfGlobalSinkState>();
-	return make_uniq<AsOfGlobalState>(gsink);
-}
-
 class AsOfLocalState : public CachingOperatorState {
 public:
 	AsOfLocalState(ClientContext &context, const PhysicalAsOfJoin &op)
@@ -638,8 +616,9 @@ void AsOfProbeBuffer::GetData(ExecutionContext &context, DataChunk &chunk) {
 
 class AsOfGlobalSourceState : public GlobalSourceState {
 public:
-	explicit AsOfGlobalSourceState(AsOfGlobalSinkState &gsink_p)
-	    : gsink(gsink_p), next_combine(0), combined(0), merged(0), mergers(0), next_left(0), flushed(0), next_right(0) {
+	AsOfGlobalSourceState(ClientContext &context, AsOfGlobalSinkState &gsink_p)
+	    : gsink(gsink_p), next_combine(0), combined(0), merged(0), mergers(0), next_left(0), flushed(0), next_right(0),
+	      threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())) {
 	}
 
 	PartitionGlobalMergeStates &GetMergeStates() {
@@ -650,6 +629,41 @@ public:
 		return *merge_states;
 	}
 
+	PartitionGlobalMergeStates &GetRightMergeStates() {
+		lock_guard<mutex> guard(lock);
+		if (!right_merge_states) {
+			//	Only sort the right side bins that have left side rows to probe them,
+			//	unless the unmatched right side rows are returned too.
+			vector<bool> bins;
+			auto &rhs_sink = gsink.rhs_sink;
+			if (rhs_sink.grouping_data && !gsink.is_outer) {
+				const auto &left_groups = gsink.lhs_sink->bin_groups;
+				bins.reserve(left_groups.size());
+				for (const auto left_group : left_groups) {
+					bins.emplace_back(left_group < left_groups.size());
+				}
+			}
+			right_merge_states = make_uniq<PartitionGlobalMergeStates>(rhs_sink, bins);
+		}
+		return *right_merge_states;
+	}
+
+	void InitializeRightOuters() {
+		lock_guard<mutex> guard(lock);
+		auto &right_outers = gsink.right_outers;
+		if (!right_outers.empty()) {
+			return;
+		}
+
+		// for FULL/RIGHT OUTER JOIN, initialize right_outers to false for every tuple
+		auto &rhs_partition = gsink.rhs_sink;
+		right_outers.reserve(rhs_partition.hash_groups.size());
+		for (const auto &hash_group : rhs_partition.hash_groups) {
+			right_outers.emplace_back(OuterJoinMarker(gsink.is_outer));
+			right_outers.back().Initialize(hash_group->count);
+		}
+	}
+
 	AsOfGlobalSinkState &gsink;
 	//! The next buffer to combine
 	atomic<size_t> next_combine;
@@ -668,16 +682,20 @@ public:
 	//! The merge handler
 	mutex lock;
 	unique_ptr<PartitionGlobalMergeStates> merge_states;
+	//! The right side merge handler
+	unique_ptr<PartitionGlobalMergeStates> right_merge_states;
+	//! The number of threads available for sorting the right side
+	const idx_t threads;
 
 public:
 	idx_t MaxThreads() override {
-		return gsink.lhs_buffers.size();
+		return MaxValue<idx_t>(gsink.lhs_buffers.size(), threads);
 	}
 };
 
 unique_ptr<GlobalSourceState> PhysicalAsOfJoin::GetGlobalSourceState(ClientContext &context) const {
 	auto &gsink = sink_state->Cast<AsOfGlobalSinkState>();
-	return make_uniq<AsOfGlobalSourceState>(gsink);
+	return make_uniq<AsOfGlobalSourceState>(context, gsink);
 }
 
 class AsOfLocalSourceState : public LocalSourceState {
@@ -689,6 +707,7 @@ public:
 	//	Return true if we were not interrupted (another thread died)
 	bool CombineLeftPartitions();
 	bool MergeLeftPartitions();
+	bool MergeRightPartitions();
 
 	idx_t BeginRightScan(const idx_t hash_bin);
 
@@ -739,6 +758,16 @@ bool AsOfLocalSourceState::MergeLeftPartitions() {
 	return !client.interrupted;
 }
 
+bool AsOfLocalSourceState::MergeRightPartitions() {
+	PartitionGlobalMergeStates::Callback local_callback;
+	PartitionLocalMergeState local_merge(gsource.gsink.rhs_sink);
+	if (!gsource.GetRightMergeStates().ExecuteTask(local_merge, local_callback) || client.interrupted) {
+		return false;
+	}
+	gsource.InitializeRightOuters();
+	return true;
+}
+
 idx_t AsOfLocalSourceState::BeginRightScan(const idx_t hash_bin_p) {
 	hash_bin = hash_bin_p;
 
@@ -775,7 +804,12 @@ SourceResultType PhysicalAsOfJoin::GetData(ExecutionContext &context, DataChunk
 		return SourceResultType::FINISHED;
 	}
 
-	//	Step 3: Join the partitions
+	//	Step 3: Sort the right side partitions that we probe
+	if (!lsource.MergeRightPartitions()) {
+		return SourceResultType::FINISHED;
+	}
+
+	//	Step 4: Join the partitions
 	auto &lhs_sink = *gsource.gsink.lhs_sink;
 	const auto left_bins = lhs_sink.grouping_data ? lhs_sink.grouping_data->GetPartitions().size() : 1;
 	while (gsource.flushed < left_bins) {
@@ -808,7 +842,7 @@ SourceResultType PhysicalAsOfJoin::GetData(ExecutionContext &context, DataChunk
 		}
 	}
 
-	//	Step 4: Emit right join matches
+	//	Step 5: Emit right join matches
 	if (!IsRightOuterJoin(join_type)) {
 		return SourceResultType::FINISHED;
 	}
@@ -0,0 +1,666 @@
+#include "duckdb/execution/operator/join/physical_interval_join.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/type_visitor.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/join/outer_join_marker.hpp"
+#include "duckdb/execution/operator/join/physical_range_join.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+static bool IsIntervalStart(ExpressionType comparison) {
+	// lhs >= rhs.start
+	return comparison == ExpressionType::COMPARE_GREATERTHAN ||
+	       comparison == ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+}
+
+PhysicalIntervalJoin::PhysicalIntervalJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                                           unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond,
+                                           JoinType join_type, idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::INTERVAL_JOIN, std::move(cond), join_type,
+                             estimated_cardinality) {
+	D_ASSERT(conditions.size() == 2);
+	start_cond = IsIntervalStart(conditions[0].comparison) ? 0 : 1;
+	end_cond = 1 - start_cond;
+	key_type = conditions[start_cond].right->return_type;
+
+	children.push_back(std::move(left));
+	children.push_back(std::move(right));
+}
+
+bool PhysicalIntervalJoin::IsSupported(const vector<JoinCondition> &conditions, JoinType join_type,
+                                       const vector<LogicalType> &rhs_types) {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::LEFT:
+		break;
+	default:
+		return false;
+	}
+	if (conditions.size() != 2) {
+		return false;
+	}
+
+	// We need one bound for the RHS interval start and one for its end
+	idx_t starts = 0;
+	for (auto &cond : conditions) {
+		switch (cond.comparison) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			++starts;
+			break;
+		default:
+			return false;
+		}
+	}
+	if (starts != 1) {
+		return false;
+	}
+
+	// Both sides have to be intervals: point lookups (x BETWEEN lo AND hi) are left to the range joins
+	auto &lhs = conditions[0];
+	auto &rhs = conditions[1];
+	if (lhs.left->Equals(*rhs.left) || lhs.right->Equals(*rhs.right)) {
+		return false;
+	}
+
+	// All the bounds are compared as a single fixed size type
+	const auto &key_type = lhs.right->return_type;
+	for (auto &cond : conditions) {
+		if (cond.left->return_type != key_type || cond.right->return_type != key_type) {
+			return false;
+		}
+	}
+	if (key_type.id() == LogicalTypeId::TIME_TZ) {
+		return false;
+	}
+	switch (key_type.InternalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+	case PhysicalType::INTERVAL:
+		break;
+	default:
+		return false;
+	}
+
+	// The RHS payload is gathered straight from the rows
+	for (auto &type : rhs_types) {
+		if (TypeVisitor::Contains(type, LogicalTypeId::ARRAY)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//! The heap size we assume for every variable size value, as we have no statistics during planning
+static constexpr idx_t INTERVAL_JOIN_VARIABLE_SIZE_ESTIMATE = 32;
+
+bool PhysicalIntervalJoin::FitsInMemory(ClientContext &context, const vector<JoinCondition> &conditions,
+                                        const PhysicalOperator &rhs) {
+	const auto &key_type = conditions[0].right->return_type;
+	auto types = rhs.types;
+	types.emplace_back(key_type);
+	types.emplace_back(key_type);
+	RowLayout layout;
+	layout.Initialize(types);
+
+	// Every RHS row is sorted and then indexed by its bounds and its row pointer
+	auto row_size = layout.GetRowWidth() + 2 * GetTypeIdSize(key_type.InternalType()) + sizeof(data_ptr_t);
+	for (auto &type : types) {
+		if (!TypeIsConstantSize(type.InternalType())) {
+			row_size += INTERVAL_JOIN_VARIABLE_SIZE_ESTIMATE;
+		}
+	}
+
+	// Merging the sorted runs needs room for both the input and the output rows
+	const auto required = 2.0 * double(rhs.estimated_cardinality) * double(row_size);
+	const auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	return required <= double(max_memory);
+}
+
+//===--------------------------------------------------------------------===//
+// Interval Index
+//===--------------------------------------------------------------------===//
+struct IntervalTreeNode {
+	//! The position of the node in the implicit tree
+	idx_t node;
+	//! The first interval covered by the node
+	idx_t begin;
+	//! The number of intervals covered by the node
+	idx_t width;
+};
+
+struct IntervalJoinProbe {
+	//! The LHS bounds for the RHS interval starts and ends
+	UnifiedVectorFormat starts;
+	UnifiedVectorFormat ends;
+	//! The next LHS row to probe
+	idx_t next_idx = 0;
+	//! The LHS row that is being probed
+	idx_t probe_idx = 0;
+	//! The number of RHS intervals whose start matches the probed row
+	idx_t limit = 0;
+	//! The subtrees of the probed row that we still have to visit
+	vector<IntervalTreeNode> pending;
+
+	void Reset() {
+		next_idx = 0;
+		probe_idx = 0;
+		limit = 0;
+		pending.clear();
+	}
+
+	bool Done(idx_t count) const {
+		return pending.empty() && next_idx >= count;
+	}
+};
+
+//! IntervalIndex stores the RHS intervals sorted by their start,
+//! together with a tree that holds the maximum end of each range of intervals.
+class IntervalIndex {
+public:
+	virtual ~IntervalIndex() = default;
+
+	static unique_ptr<IntervalIndex> Create(const PhysicalIntervalJoin &op);
+
+	//! Index the rows sorted by their start, which remain pinned by the handles while probing
+	void Build(GlobalSortState &global_sort_state, idx_t start_col, idx_t end_col, vector<BufferHandle> &handles);
+
+	//! Find up to STANDARD_VECTOR_SIZE (LHS, RHS) matches for the probed chunk
+	virtual idx_t Probe(IntervalJoinProbe &probe, idx_t count, SelectionVector &lhs_sel,
+	                    data_ptr_t rhs_rows[]) const = 0;
+
+	idx_t Count() const {
+		return rows.size();
+	}
+
+protected:
+	virtual void Append(data_ptr_t row, idx_t start_offset, idx_t end_offset) = 0;
+	virtual void Finalize() = 0;
+
+	//! The RHS rows in start order
+	vector<data_ptr_t> rows;
+};
+
+void IntervalIndex::Build(GlobalSortState &global_sort_state, idx_t start_col, idx_t end_col,
+                          vector<BufferHandle> &handles) {
+	if (global_sort_state.sorted_blocks.empty()) {
+		return;
+	}
+	D_ASSERT(global_sort_state.sorted_blocks.size() == 1);
+	auto &payload = *global_sort_state.sorted_blocks[0]->payload_data;
+	auto &buffer_manager = global_sort_state.buffer_manager;
+
+	const auto &layout = payload.layout;
+	const auto row_width = layout.GetRowWidth();
+	const auto start_offset = layout.GetOffsets()[start_col];
+	const auto end_offset = layout.GetOffsets()[end_col];
+
+	idx_t start_entry, start_idx_in_entry;
+	RowLayout::ValidityBytes::GetEntryIndex(start_col, start_entry, start_idx_in_entry);
+	idx_t end_entry, end_idx_in_entry;
+	RowLayout::ValidityBytes::GetEntryIndex(end_col, end_entry, end_idx_in_entry);
+
+	// Keep all the rows pinned so we can gather the payloads from the row pointers
+	for (idx_t block_idx = 0; block_idx < payload.data_blocks.size(); block_idx++) {
+		auto &data_block = *payload.data_blocks[block_idx];
+		auto data_handle = buffer_manager.Pin(data_block.block);
+		auto row = data_handle.Ptr();
+		if (payload.swizzled && !layout.AllConstant()) {
+			// The sort went external, so we point the rows back at their heap
+			auto heap_handle = buffer_manager.Pin(payload.heap_blocks[block_idx]->block);
+			RowOperations::UnswizzlePointers(layout, row, heap_handle.Ptr(), data_block.count);
+			handles.emplace_back(std::move(heap_handle));
+		}
+		for (idx_t i = 0; i < data_block.count; i++, row += row_width) {
+			// Intervals with a NULL bound can never match
+			RowLayout::ValidityBytes row_mask(row);
+			if (!row_mask.RowIsValid(row_mask.GetValidityEntryUnsafe(start_entry), start_idx_in_entry) ||
+			    !row_mask.RowIsValid(row_mask.GetValidityEntryUnsafe(end_entry), end_idx_in_entry)) {
+				continue;
+			}
+			Append(row, start_offset, end_offset);
+		}
+		handles.emplace_back(std::move(data_handle));
+	}
+	payload.swizzled = false;
+
+	Finalize();
+}
+
+template <typename T>
+class TypedIntervalIndex : public IntervalIndex {
+public:
+	TypedIntervalIndex(bool strict_start, bool strict_end) : strict_start(strict_start), strict_end(strict_end) {
+	}
+
+	idx_t Probe(IntervalJoinProbe &probe, idx_t count, SelectionVector &lhs_sel, data_ptr_t rhs_rows[]) const override;
+
+protected:
+	void Append(data_ptr_t row, idx_t start_offset, idx_t end_offset) override;
+	void Finalize() override;
+
+private:
+	//! The number of intervals that start before the given bound
+	idx_t StartCount(const T &bound) const;
+	//! Whether an end (or the maximum end of a subtree) is past the given bound
+	bool EndMatches(const T &end, const T &bound) const {
+		return strict_end ? GreaterThan::Operation(end, bound) : GreaterThanEquals::Operation(end, bound);
+	}
+	T MaxEnd(const IntervalTreeNode &entry) const {
+		return entry.width == 1 ? ends[entry.begin] : maxima[entry.node];
+	}
+	T BuildTree(idx_t node, idx_t begin, idx_t width);
+
+	//! Whether the interval bounds exclude their limits
+	const bool strict_start;
+	const bool strict_end;
+	//! The interval starts and ends in start order
+	vector<T> starts;
+	vector<T> ends;
+	//! The number of leaves in the implicit tree
+	idx_t leaves = 0;
+	//! The maximum end of the intervals below every inner node
+	vector<T> maxima;
+};
+
+template <typename T>
+void TypedIntervalIndex<T>::Append(data_ptr_t row, idx_t start_offset, idx_t end_offset) {
+	// The rows arrive in start order
+	starts.emplace_back(Load<T>(row + start_offset));
+	ends.emplace_back(Load<T>(row + end_offset));
+	rows.emplace_back(row);
+}
+
+template <typename T>
+T TypedIntervalIndex<T>::BuildTree(idx_t node, idx_t begin, idx_t width) {
+	if (width == 1) {
+		return ends[begin];
+	}
+	// The padding past the last interval is never visited, so we only have to cover the left child
+	const auto half = width / 2;
+	auto result = BuildTree(2 * node, begin, half);
+	if (begin + half < ends.size()) {
+		const auto right = BuildTree(2 * node + 1, begin + half, half);
+		if (GreaterThan::Operation(right, result)) {
+			result = right;
+		}
+	}
+	maxima[node] = result;
+	return result;
+}
+
+template <typename T>
+void TypedIntervalIndex<T>::Finalize() {
+	if (ends.empty()) {
+		return;
+	}
+
+	leaves = NextPowerOfTwo(ends.size());
+	maxima.resize(leaves);
+	BuildTree(1, 0, leaves);
+}
+
+template <typename T>
+idx_t TypedIntervalIndex<T>::StartCount(const T &bound) const {
+	if (strict_start) {
+		return NumericCast<idx_t>(
+		    std::lower_bound(starts.begin(), starts.end(), bound,
+		                     [](const T &start, const T &val) { return LessThan::Operation(start, val); }) -
+		    starts.begin());
+	}
+	return NumericCast<idx_t>(
+	    std::upper_bound(starts.begin(), starts.end(), bound,
+	                     [](const T &val, const T &start) { return LessThan::Operation(val, start); }) -
+	    starts.begin());
+}
+
+template <typename T>
+idx_t TypedIntervalIndex<T>::Probe(IntervalJoinProbe &probe, idx_t count, SelectionVector &lhs_sel,
+                                   data_ptr_t rhs_rows[]) const {
+	const auto start_data = UnifiedVectorFormat::GetData<T>(probe.starts);
+	const auto end_data = UnifiedVectorFormat::GetData<T>(probe.ends);
+
+	idx_t result_count = 0;
+	while (result_count < STANDARD_VECTOR_SIZE) {
+		if (probe.pending.empty()) {
+			// Move on to the next LHS row
+			if (probe.next_idx >= count) {
+				break;
+			}
+			probe.probe_idx = probe.next_idx++;
+			const auto start_idx = probe.starts.sel->get_index(probe.probe_idx);
+			const auto end_idx = probe.ends.sel->get_index(probe.probe_idx);
+			if (!probe.starts.validity.RowIsValid(start_idx) || !probe.ends.validity.RowIsValid(end_idx)) {
+				continue;
+			}
+			// Only the intervals that start early enough can match
+			probe.limit = StartCount(start_data[start_idx]);
+			if (probe.limit) {
+				probe.pending.push_back({1, 0, leaves});
+			}
+			continue;
+		}
+
+		const auto entry = probe.pending.back();
+		probe.pending.pop_back();
+		const auto &bound = end_data[probe.ends.sel->get_index(probe.probe_idx)];
+		if (!EndMatches(MaxEnd(entry), bound)) {
+			continue;
+		}
+		if (entry.width == 1) {
+			lhs_sel.set_index(result_count, probe.probe_idx);
+			rhs_rows[result_count++] = rows[entry.begin];
+			continue;
+		}
+		// Visit the left child first so the matches come out in start order
+		const auto half = entry.width / 2;
+		if (entry.begin + half < probe.limit) {
+			probe.pending.push_back({2 * entry.node + 1, entry.begin + half, half});
+		}
+		probe.pending.push_back({2 * entry.node, entry.begin, half});
+	}
+
+	return result_count;
+}
+
+unique_ptr<IntervalIndex> IntervalIndex::Create(const PhysicalIntervalJoin &op) {
+	const auto strict_start = op.conditions[op.start_cond].comparison == ExpressionType::COMPARE_GREATERTHAN;
+	const auto strict_end = op.conditions[op.end_cond].comparison == ExpressionType::COMPARE_LESSTHAN;
+	switch (op.key_type.InternalType()) {
+	case PhysicalType::INT8:
+		return make_uniq<TypedIntervalIndex<int8_t>>(strict_start, strict_end);
+	case PhysicalType::INT16:
+		return make_uniq<TypedIntervalIndex<int16_t>>(strict_start, strict_end);
+	case PhysicalType::INT32:
+		return make_uniq<TypedIntervalIndex<int32_t>>(strict_start, strict_end);
+	case PhysicalType::INT64:
+		return make_uniq<TypedIntervalIndex<int64_t>>(strict_start, strict_end);
+	case PhysicalType::INT128:
+		return make_uniq<TypedIntervalIndex<hugeint_t>>(strict_start, strict_end);
+	case PhysicalType::UINT8:
+		return make_uniq<TypedIntervalIndex<uint8_t>>(strict_start, strict_end);
+	case PhysicalType::UINT16:
+		return make_uniq<TypedIntervalIndex<uint16_t>>(strict_start, strict_end);
+	case PhysicalType::UINT32:
+		return make_uniq<TypedIntervalIndex<uint32_t>>(strict_start, strict_end);
+	case PhysicalType::UINT64:
+		return make_uniq<TypedIntervalIndex<uint64_t>>(strict_start, strict_end);
+	case PhysicalType::UINT128:
+		return make_uniq<TypedIntervalIndex<uhugeint_t>>(strict_start, strict_end);
+	case PhysicalType::FLOAT:
+		return make_uniq<TypedIntervalIndex<float>>(strict_start, strict_end);
+	case PhysicalType::DOUBLE:
+		return make_uniq<TypedIntervalIndex<double>>(strict_start, strict_end);
+	case PhysicalType::INTERVAL:
+		return make_uniq<TypedIntervalIndex<interval_t>>(strict_start, strict_end);
+	default:
+		throw NotImplementedException("Unimplemented type for interval join: %s", op.key_type.ToString());
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class IntervalJoinGlobalSinkState : public GlobalSinkState {
+public:
+	using GlobalSortedTable = PhysicalRangeJoin::GlobalSortedTable;
+
+	IntervalJoinGlobalSinkState(ClientContext &context, const PhysicalIntervalJoin &op) {
+		// The RHS payload is followed by the interval start and end
+		auto types = op.children[1]->types;
+		start_col = types.size();
+		types.emplace_back(op.key_type);
+		end_col = types.size();
+		types.emplace_back(op.key_type);
+		RowLayout layout;
+		layout.Initialize(types);
+
+		// The RHS rows are sorted by their interval start
+		vector<BoundOrderByNode> orders;
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(op.key_type, 0U));
+		table = make_uniq<GlobalSortedTable>(context, orders, layout, op);
+	}
+
+	//! The column indexes of the interval bounds
+	idx_t start_col;
+	idx_t end_col;
+	//! The sorted RHS rows
+	unique_ptr<GlobalSortedTable> table;
+	//! The handles that keep the sorted RHS rows pinned
+	vector<BufferHandle> handles;
+	//! The index over the RHS intervals
+	unique_ptr<IntervalIndex> index;
+};
+
+class IntervalJoinLocalSinkState : public LocalSinkState {
+public:
+	IntervalJoinLocalSinkState(ClientContext &context, const PhysicalIntervalJoin &op,
+	                           IntervalJoinGlobalSinkState &gstate)
+	    : executor(context) {
+		executor.AddExpression(*op.conditions[op.start_cond].right);
+		executor.AddExpression(*op.conditions[op.end_cond].right);
+
+		auto &allocator = Allocator::Get(context);
+		keys.Initialize(allocator, {op.key_type, op.key_type});
+		sort_keys.InitializeEmpty({op.key_type});
+		rows.InitializeEmpty(gstate.table->global_sort_state.payload_layout.GetTypes());
+	}
+
+	//! The executor of the RHS interval bounds
+	ExpressionExecutor executor;
+	//! The RHS interval bounds
+	DataChunk keys;
+	//! The interval starts to sort on
+	DataChunk sort_keys;
+	//! The payload and bounds to sort
+	DataChunk rows;
+	//! The local sort state
+	LocalSortState local_sort_state;
+};
+
+unique_ptr<GlobalSinkState> PhysicalIntervalJoin::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<IntervalJoinGlobalSinkState>(context, *this);
+}
+
+unique_ptr<LocalSinkState> PhysicalIntervalJoin::GetLocalSinkState(ExecutionContext &context) const {
+	auto &gstate = sink_state->Cast<IntervalJoinGlobalSinkState>();
+	return make_uniq<IntervalJoinLocalSinkState>(context.client, *this, gstate);
+}
+
+SinkResultType PhysicalIntervalJoin::Sink(ExecutionContext &context, DataChunk &chunk,
+                                          OperatorSinkInput &input) const {
+	auto &gstate = input.global_state.Cast<IntervalJoinGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<IntervalJoinLocalSinkState>();
+
+	auto &global_sort_state = gstate.table->global_sort_state;
+	auto &local_sort_state = lstate.local_sort_state;
+	if (!local_sort_state.initialized) {
+		local_sort_state.Initialize(global_sort_state, global_sort_state.buffer_manager);
+	}
+
+	lstate.keys.Reset();
+	lstate.executor.Execute(chunk, lstate.keys);
+
+	auto &rows = lstate.rows;
+	for (idx_t col_idx = 0; col_idx < chunk.ColumnCount(); ++col_idx) {
+		rows.data[col_idx].Reference(chunk.data[col_idx]);
+	}
+	rows.data[chunk.ColumnCount()].Reference(lstate.keys.data[0]);
+	rows.data[chunk.ColumnCount() + 1].Reference(lstate.keys.data[1]);
+	rows.SetCardinality(chunk);
+
+	auto &sort_keys = lstate.sort_keys;
+	sort_keys.data[0].Reference(lstate.keys.data[0]);
+	sort_keys.SetCardinality(chunk);
+
+	local_sort_state.SinkChunk(sort_keys, rows);
+
+	// When sorting data reaches a certain size, we sort it
+	if (local_sort_state.SizeInBytes() >= gstate.table->memory_per_thread) {
+		local_sort_state.Sort(global_sort_state, true);
+	}
+
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalIntervalJoin::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<IntervalJoinGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<IntervalJoinLocalSinkState>();
+
+	gstate.table->global_sort_state.AddLocalState(lstate.local_sort_state);
+
+	auto &client_profiler = QueryProfiler::Get(context.client);
+	context.thread.profiler.Flush(*this);
+	client_profiler.Flush(context.thread.profiler);
+	return SinkCombineResultType::FINISHED;
+}
+
+class IntervalIndexBuildEvent : public BasePipelineEvent {
+public:
+	IntervalIndexBuildEvent(IntervalJoinGlobalSinkState &gstate_p, Pipeline &pipeline_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p) {
+	}
+
+	IntervalJoinGlobalSinkState &gstate;
+
+public:
+	void Schedule() override {
+		// The index is built in a single pass over the merged rows when the event finishes
+	}
+
+	void FinishEvent() override {
+		gstate.index->Build(gstate.table->global_sort_state, gstate.start_col, gstate.end_col, gstate.handles);
+	}
+};
+
+SinkFinalizeType PhysicalIntervalJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<IntervalJoinGlobalSinkState>();
+	auto &table = *gstate.table;
+
+	gstate.index = IntervalIndex::Create(*this);
+	if (table.global_sort_state.sorted_blocks.empty() && EmptyResultIfRHSIsEmpty()) {
+		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
+	}
+
+	// Merge the sorted runs in parallel and index the result once they are merged
+	event.InsertEvent(make_shared_ptr<IntervalIndexBuildEvent>(gstate, pipeline));
+	table.Finalize(pipeline, event);
+
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Operator
+//===--------------------------------------------------------------------===//
+class IntervalJoinOperatorState : public CachingOperatorState {
+public:
+	IntervalJoinOperatorState(ClientContext &context, const PhysicalIntervalJoin &op)
+	    : executor(context), fetch_next_left(true), lhs_sel(STANDARD_VECTOR_SIZE), rhs_rows(LogicalType::POINTER),
+	      left_outer(IsLeftOuterJoin(op.join_type)) {
+		executor.AddExpression(*op.conditions[op.start_cond].left);
+		executor.AddExpression(*op.conditions[op.end_cond].left);
+		keys.Initialize(Allocator::Get(context), {op.key_type, op.key_type});
+		left_outer.Initialize(STANDARD_VECTOR_SIZE);
+	}
+
+	//! The executor of the LHS interval bounds
+	ExpressionExecutor executor;
+	//! The LHS interval bounds
+	DataChunk keys;
+	bool fetch_next_left;
+	//! The state of the index probe
+	IntervalJoinProbe probe;
+	//! The matching LHS rows
+	SelectionVector lhs_sel;
+	//! The matching RHS rows
+	Vector rhs_rows;
+	OuterJoinMarker left_outer;
+
+public:
+	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
+		context.thread.profiler.Flush(op);
+	}
+};
+
+unique_ptr<OperatorState> PhysicalIntervalJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IntervalJoinOperatorState>(context.client, *this);
+}
+
+OperatorResultType PhysicalIntervalJoin::ExecuteInternal(ExecutionContext &context, DataChunk &input,
+                                                         DataChunk &chunk, GlobalOperatorState &gstate_p,
+                                                         OperatorState &state_p) const {
+	auto &gstate = sink_state->Cast<IntervalJoinGlobalSinkState>();
+	auto &state = state_p.Cast<IntervalJoinOperatorState>();
+	auto &index = *gstate.index;
+
+	if (index.Count() == 0) {
+		// empty RHS (or only NULL intervals)
+		if (!EmptyResultIfRHSIsEmpty()) {
+			ConstructEmptyJoinResult(join_type, false, input, chunk);
+			return OperatorResultType::NEED_MORE_INPUT;
+		} else {
+			return OperatorResultType::FINISHED;
+		}
+	}
+
+	auto &probe = state.probe;
+	if (state.fetch_next_left) {
+		state.keys.Reset();
+		state.executor.Execute(input, state.keys);
+		state.keys.data[0].ToUnifiedFormat(input.size(), probe.starts);
+		state.keys.data[1].ToUnifiedFormat(input.size(), probe.ends);
+		probe.Reset();
+		state.fetch_next_left = false;
+	}
+
+	const auto rhs_rows = FlatVector::GetData<data_ptr_t>(state.rhs_rows);
+	const auto match_count = index.Probe(probe, input.size(), state.lhs_sel, rhs_rows);
+	if (match_count > 0) {
+		state.left_outer.SetMatches(state.lhs_sel, match_count);
+
+		chunk.Slice(input, state.lhs_sel, match_count);
+		const auto &incremental_sel = *FlatVector::IncrementalSelectionVector();
+		const auto &layout = gstate.table->global_sort_state.payload_layout;
+		for (idx_t col_idx = 0; col_idx < children[1]->types.size(); ++col_idx) {
+			auto &target = chunk.data[input.ColumnCount() + col_idx];
+			RowOperations::Gather(state.rhs_rows, incremental_sel, target, incremental_sel, match_count, layout,
+			                      col_idx);
+		}
+		chunk.SetCardinality(match_count);
+		return OperatorResultType::HAVE_MORE_OUTPUT;
+	}
+
+	// we exhausted the matches of this chunk: move to the next chunk on the left
+	state.fetch_next_left = true;
+	if (state.left_outer.Enabled()) {
+		state.left_outer.ConstructLeftJoinResult(input, chunk);
+		state.left_outer.Reset();
+	}
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+} // namespace duckdb
@@ -6,6 +6,8 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/parallel/base_pipeline_event.hpp"
+#include "duckdb/parallel/executor_task.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -83,8 +85,12 @@ public:
 
 public:
 	void Sink(DataChunk &input);
+	//! Combines a finalized heap into this heap
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Appends the top rows of this (finalized) heap to a global sort as a single run
+	void CombineSorted(GlobalSortState &global_sort);
+	//! Reduces the heap to limit + offset entries (if it has grown large enough) - returns true if it was reduced
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -256,7 +262,7 @@ void TopNHeap::Sink(DataChunk &input) {
 }
 
 void TopNHeap::Combine(TopNHeap &other) {
-	other.Finalize();
+	D_ASSERT(other.sort_state.is_sorted);
 
 	TopNScanState state;
 	other.InitializeScan(state, false);
@@ -271,15 +277,40 @@ void TopNHeap::Combine(TopNHeap &other) {
 	Reduce();
 }
 
+void TopNHeap::CombineSorted(GlobalSortState &global_sort) {
+	D_ASSERT(sort_state.is_sorted);
+
+	LocalSortState local_sort;
+	local_sort.Initialize(global_sort, buffer_manager);
+
+	TopNScanState state;
+	InitializeScan(state, false);
+	idx_t count = 0;
+	while (true) {
+		payload_chunk.Reset();
+		Scan(state, payload_chunk);
+		if (payload_chunk.size() == 0) {
+			break;
+		}
+		sort_chunk.Reset();
+		executor.Execute(payload_chunk, sort_chunk);
+		local_sort.SinkChunk(sort_chunk, payload_chunk);
+		count += payload_chunk.size();
+	}
+	if (count > 0) {
+		global_sort.AddLocalState(local_sort);
+	}
+}
+
 void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +337,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return true;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -402,11 +434,14 @@ class TopNGlobalState : public GlobalSinkState {
 public:
 	TopNGlobalState(ClientContext &context, const vector<LogicalType> &payload_types,
 	                const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : heap(context, payload_types, orders, limit, offset) {
+	    : heap(context, payload_types, orders, limit, offset),
+	      parallel_merge(limit + offset >= PhysicalTopN::PARALLEL_MERGE_THRESHOLD) {
 	}
 
 	mutex lock;
 	TopNHeap heap;
+	//! Whether the local heaps are merged in parallel instead of being combined into the global heap one by one
+	const bool parallel_merge;
 };
 
 class TopNLocalState : public LocalSinkState {
@@ -424,9 +459,22 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// the filter might still be set from a previous execution of this plan
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
+//! Tightens the dynamic filter to the boundary value of the first order in the heap
+//! Rows that sort after the boundary value cannot end up in the top-n, so the scan does not need to emit them
+static void UpdateDynamicFilter(DynamicFilterData &dynamic_filter, TopNHeap &heap) {
+	if (!heap.has_boundary_values) {
+		return;
+	}
+	dynamic_filter.SetValue(heap.boundary_values.GetValue(0, 0));
+}
+
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
@@ -434,7 +482,9 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		UpdateDynamicFilter(*dynamic_filter, sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -445,9 +495,20 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	auto &gstate = input.global_state.Cast<TopNGlobalState>();
 	auto &lstate = input.local_state.Cast<TopNLocalState>();
 
+	// sort the local top N before we grab the lock
+	lstate.heap.Finalize();
+	if (gstate.parallel_merge) {
+		// large heaps: the local top N becomes one of the sorted runs that are merged in parallel during Finalize
+		lstate.heap.CombineSorted(*gstate.heap.sort_state.global_state);
+		return SinkCombineResultType::FINISHED;
+	}
+
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	if (dynamic_filter) {
+		UpdateDynamicFilter(*dynamic_filter, gstate.heap);
+	}
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -455,11 +516,86 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
+class TopNMergeTask : public ExecutorTask {
+public:
+	TopNMergeTask(shared_ptr<Event> event_p, ClientContext &context, TopNGlobalState &state,
+	              const PhysicalOperator &op_p)
+	    : ExecutorTask(context, std::move(event_p), op_p), context(context), state(state) {
+	}
+
+	TaskExecutionResult ExecuteTask(TaskExecutionMode mode) override {
+		auto &global_sort_state = *state.heap.sort_state.global_state;
+		MergeSorter merge_sorter(global_sort_state, BufferManager::GetBufferManager(context));
+		merge_sorter.PerformInMergeRound();
+		event->FinishTask();
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+private:
+	ClientContext &context;
+	TopNGlobalState &state;
+};
+
+class TopNMergeEvent : public BasePipelineEvent {
+public:
+	TopNMergeEvent(TopNGlobalState &gstate_p, Pipeline &pipeline_p, const PhysicalOperator &op_p)
+	    : BasePipelineEvent(pipeline_p), gstate(gstate_p), op(op_p) {
+	}
+
+	TopNGlobalState &gstate;
+	const PhysicalOperator &op;
+
+public:
+	static void ScheduleMergeTasks(Pipeline &pipeline, Event &event, TopNGlobalState &gstate,
+	                               const PhysicalOperator &op) {
+		gstate.heap.sort_state.global_state->InitializeMergeRound();
+		auto new_event = make_shared_ptr<TopNMergeEvent>(gstate, pipeline, op);
+		event.InsertEvent(std::move(new_event));
+	}
+
+	void Schedule() override {
+		auto &context = pipeline->GetClientContext();
+
+		auto &ts = TaskScheduler::GetScheduler(context);
+		auto num_threads = NumericCast<idx_t>(ts.NumberOfThreads());
+
+		vector<shared_ptr<Task>> merge_tasks;
+		for (idx_t tnum = 0; tnum < num_threads; tnum++) {
+			merge_tasks.push_back(make_uniq<TopNMergeTask>(shared_from_this(), context, gstate, op));
+		}
+		SetTasks(std::move(merge_tasks));
+	}
+
+	void FinishEvent() override {
+		auto &global_sort_state = *gstate.heap.sort_state.global_state;
+
+		global_sort_state.CompleteMergeRound();
+		if (global_sort_state.sorted_blocks.size() > 1) {
+			ScheduleMergeTasks(*pipeline, *this, gstate, op);
+		}
+	}
+};
+
 SinkFinalizeType PhysicalTopN::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                         OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<TopNGlobalState>();
-	// global finalize: compute the final top N
-	gstate.heap.Finalize();
+	if (!gstate.parallel_merge) {
+		// global finalize: compute the final top N
+		gstate.heap.Finalize();
+		return SinkFinalizeType::READY;
+	}
+
+	// merge the sorted runs of the local heaps in parallel
+	auto &sort_state = gstate.heap.sort_state;
+	auto &global_sort_state = *sort_state.global_state;
+	sort_state.is_sorted = true;
+	if (global_sort_state.sorted_blocks.empty()) {
+		return SinkFinalizeType::READY;
+	}
+	global_sort_state.PrepareMergePhase();
+	if (global_sort_state.sorted_blocks.size() > 1) {
+		TopNMergeEvent::ScheduleMergeTasks(pipeline, event, gstate, *this);
+	}
 	return SinkFinalizeType::READY;
 }
 
@@ -2,6 +2,7 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_interval_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
@@ -215,7 +216,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 				can_iejoin = false;
 			}
 		}
-		if (can_iejoin) {
+		if (can_iejoin && PhysicalIntervalJoin::IsSupported(op.conditions, op.join_type, right->types) &&
+		    PhysicalIntervalJoin::FitsInMemory(context, op.conditions, *right)) {
+			// interval overlap join: index the RHS intervals (IEJoin can spill when they do not fit in memory)
+			plan = make_uniq<PhysicalIntervalJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
+			                                       op.join_type, op.estimated_cardinality);
+		} else if (can_iejoin) {
 			plan = make_uniq<PhysicalIEJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 			                                 op.join_type, op.estimated_cardinality);
 		} else if (can_merge) {
@@ -685,7 +685,7 @@ SourceResultType RadixHTGlobalSourceState::AssignTask(RadixHTGlobalSinkState &si
 
 RadixHTLocalSourceState::RadixHTLocalSourceState(ExecutionContext &context, const RadixPartitionedHashTable &radix_ht)
     : task(RadixHTSourceTaskType::NO_TASK), scan_status(RadixHTScanStatus::DONE), layout(radix_ht.GetLayout().Copy()),
-      aggregate_allocator(BufferAllocator::Get(context.client)) {
+      aggregate_allocator(BufferAllocator::Get(context.client, MemoryTag::AGGREGATE_STATE)) {
 	auto &allocator = BufferAllocator::Get(context.client);
 	auto scan_chunk_types = radix_ht.group_types;
 	for (auto &aggr_type : radix_ht.op.aggregate_return_types) {
@@ -861,7 +861,7 @@ SourceResultType RadixPartitionedHashTable::GetData(ExecutionContext &context, D
 				chunk.data[null_group].SetVectorType(VectorType::CONSTANT_VECTOR);
 				ConstantVector::SetNull(chunk.data[null_group], true);
 			}
-			ArenaAllocator allocator(BufferAllocator::Get(context.client));
+			ArenaAllocator allocator(BufferAllocator::Get(context.client, MemoryTag::AGGREGATE_STATE));
 			for (idx_t i = 0; i < op.aggregates.size(); i++) {
 				D_ASSERT(op.aggregates[i]->GetExpressionClass() == ExpressionClass::BOUND_AGGREGATE);
 				auto &aggr = op.aggregates[i]->Cast<BoundAggregateExpression>();
@@ -1066,7 +1066,7 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowSegmentTree>(aggr, arg_types, return_type, mode, wexpr.exclude_clause);
 	}
 
-	gsink = aggregator->GetGlobalState(group_count, partition_mask);
+	gsink = aggregator->GetGlobalState(context, group_count, partition_mask);
 }
 
 unique_ptr<WindowExecutorGlobalState> WindowAggregateExecutor::GetGlobalState(const idx_t payload_count,
@@ -1237,6 +1237,217 @@ void WindowAggregateExecutor::EvaluateInternal(WindowExecutorGlobalState &gstate
 	aggregator->Evaluate(*gsink, agg_state, lastate.bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSharedAggregate
+//===--------------------------------------------------------------------===//
+struct WindowSharedAggregateInfo : public AggregateFunctionInfo {
+	//! The aggregates that are evaluated together
+	vector<AggregateObject> aggregates;
+	//! The offset of the state of each aggregate in the combined state
+	vector<idx_t> state_offsets;
+	//! The argument columns of each aggregate
+	vector<vector<idx_t>> input_columns;
+	//! The size of the combined state
+	idx_t state_size = 0;
+};
+
+struct WindowSharedAggregateData : public FunctionData {
+	explicit WindowSharedAggregateData(shared_ptr<WindowSharedAggregateInfo> info_p) : info(std::move(info_p)) {
+	}
+
+	unique_ptr<FunctionData> Copy() const override {
+		return make_uniq<WindowSharedAggregateData>(info);
+	}
+	bool Equals(const FunctionData &other_p) const override {
+		auto &other = other_p.Cast<WindowSharedAggregateData>();
+		return info == other.info;
+	}
+
+	shared_ptr<WindowSharedAggregateInfo> info;
+};
+
+static const WindowSharedAggregateInfo &GetSharedAggregateInfo(AggregateInputData &aggr_input_data) {
+	return *aggr_input_data.bind_data->Cast<WindowSharedAggregateData>().info;
+}
+
+//! Points the target at the states of a single aggregate in the combined states
+static void GetAggregateStates(Vector &states, idx_t count, idx_t state_offset, Vector &target) {
+	UnifiedVectorFormat sdata;
+	states.ToUnifiedFormat(count, sdata);
+	auto state_ptrs = UnifiedVectorFormat::GetData<data_ptr_t>(sdata);
+	auto target_ptrs = FlatVector::GetData<data_ptr_t>(target);
+	for (idx_t i = 0; i < count; ++i) {
+		target_ptrs[i] = state_ptrs[sdata.sel->get_index(i)] + state_offset;
+	}
+}
+
+static idx_t SharedAggregateStateSize(const AggregateFunction &function) {
+	return function.function_info->Cast<WindowSharedAggregateInfo>().state_size;
+}
+
+static void SharedAggregateInitialize(const AggregateFunction &function, data_ptr_t state) {
+	auto &info = function.function_info->Cast<WindowSharedAggregateInfo>();
+	for (idx_t aggr_idx = 0; aggr_idx < info.aggregates.size(); ++aggr_idx) {
+		auto &aggr = info.aggregates[aggr_idx].function;
+		aggr.initialize(aggr, state + info.state_offsets[aggr_idx]);
+	}
+}
+
+static void SharedAggregateUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                  Vector &states, idx_t count) {
+	auto &info = GetSharedAggregateInfo(aggr_input_data);
+	Vector aggr_states(LogicalType::POINTER, count);
+	vector<Vector> aggr_inputs;
+	for (idx_t aggr_idx = 0; aggr_idx < info.aggregates.size(); ++aggr_idx) {
+		auto &aggr = info.aggregates[aggr_idx];
+		auto &columns = info.input_columns[aggr_idx];
+		aggr_inputs.clear();
+		aggr_inputs.reserve(columns.size());
+		for (const auto column_idx : columns) {
+			D_ASSERT(column_idx < input_count);
+			aggr_inputs.emplace_back(inputs[column_idx]);
+		}
+		GetAggregateStates(states, count, info.state_offsets[aggr_idx], aggr_states);
+		AggregateInputData aggr_data(aggr.GetFunctionData(), aggr_input_data.allocator, aggr_input_data.combine_type);
+		aggr.function.update(aggr_inputs.data(), aggr_data, aggr_inputs.size(), aggr_states, count);
+	}
+}
+
+static void SharedAggregateCombine(Vector &source, Vector &target, AggregateInputData &aggr_input_data, idx_t count) {
+	auto &info = GetSharedAggregateInfo(aggr_input_data);
+	Vector source_states(LogicalType::POINTER, count);
+	Vector target_states(LogicalType::POINTER, count);
+	for (idx_t aggr_idx = 0; aggr_idx < info.aggregates.size(); ++aggr_idx) {
+		auto &aggr = info.aggregates[aggr_idx];
+		GetAggregateStates(source, count, info.state_offsets[aggr_idx], source_states);
+		GetAggregateStates(target, count, info.state_offsets[aggr_idx], target_states);
+		AggregateInputData aggr_data(aggr.GetFunctionData(), aggr_input_data.allocator, aggr_input_data.combine_type);
+		aggr.function.combine(source_states, target_states, aggr_data, count);
+	}
+}
+
+static void SharedAggregateFinalize(Vector &states, AggregateInputData &aggr_input_data, Vector &result, idx_t count,
+                                    idx_t offset) {
+	auto &info = GetSharedAggregateInfo(aggr_input_data);
+	auto &entries = StructVector::GetEntries(result);
+	Vector aggr_states(LogicalType::POINTER, count);
+	for (idx_t aggr_idx = 0; aggr_idx < info.aggregates.size(); ++aggr_idx) {
+		auto &aggr = info.aggregates[aggr_idx];
+		GetAggregateStates(states, count, info.state_offsets[aggr_idx], aggr_states);
+		AggregateInputData aggr_data(aggr.GetFunctionData(), aggr_input_data.allocator, aggr_input_data.combine_type);
+		aggr.function.finalize(aggr_states, aggr_data, *entries[aggr_idx], count, offset);
+	}
+}
+
+static void SharedAggregateDestructor(Vector &states, AggregateInputData &aggr_input_data, idx_t count) {
+	auto &info = GetSharedAggregateInfo(aggr_input_data);
+	Vector aggr_states(LogicalType::POINTER, count);
+	for (idx_t aggr_idx = 0; aggr_idx < info.aggregates.size(); ++aggr_idx) {
+		auto &aggr = info.aggregates[aggr_idx];
+		if (!aggr.function.destructor) {
+			continue;
+		}
+		GetAggregateStates(states, count, info.state_offsets[aggr_idx], aggr_states);
+		AggregateInputData aggr_data(aggr.GetFunctionData(), aggr_input_data.allocator, aggr_input_data.combine_type);
+		aggr.function.destructor(aggr_states, aggr_data, count);
+	}
+}
+
+bool WindowSharedAggregate::CanShare(const BoundWindowExpression &wexpr, ClientContext &context,
+                                     WindowAggregationMode mode) {
+	if (wexpr.type != ExpressionType::WINDOW_AGGREGATE || !wexpr.aggregate) {
+		return false;
+	}
+	//	The naive aggregator is used for validation, so keep the aggregates separate
+	if (!ClientConfig::GetConfig(context).enable_optimizer || mode == WindowAggregationMode::SEPARATE) {
+		return false;
+	}
+	//	DISTINCT aggregates build their own merge sort trees
+	if (wexpr.distinct) {
+		return false;
+	}
+	//	Custom window aggregates manage their own state
+	if (wexpr.aggregate->window && mode < WindowAggregationMode::COMBINE) {
+		return false;
+	}
+	if (!wexpr.aggregate->combine || wexpr.children.empty()) {
+		return false;
+	}
+	//	A volatile filter has to be evaluated for each aggregate
+	return !wexpr.filter_expr || !wexpr.filter_expr->IsVolatile();
+}
+
+bool WindowSharedAggregate::FramesAreShared(const BoundWindowExpression &lhs, const BoundWindowExpression &rhs) {
+	if (!lhs.KeysAreCompatible(rhs)) {
+		return false;
+	}
+	if (lhs.start != rhs.start || lhs.end != rhs.end || lhs.exclude_clause != rhs.exclude_clause) {
+		return false;
+	}
+	if (!Expression::Equals(lhs.start_expr, rhs.start_expr) || !Expression::Equals(lhs.end_expr, rhs.end_expr)) {
+		return false;
+	}
+	return Expression::Equals(lhs.filter_expr, rhs.filter_expr);
+}
+
+unique_ptr<BoundWindowExpression>
+WindowSharedAggregate::Create(const vector<reference<BoundWindowExpression>> &wexprs) {
+	D_ASSERT(!wexprs.empty());
+
+	//	The frames, partitions and orders are taken from the first aggregate
+	auto result = unique_ptr_cast<Expression, BoundWindowExpression>(wexprs[0].get().Copy());
+	result->children.clear();
+
+	auto info = make_shared_ptr<WindowSharedAggregateInfo>();
+	vector<LogicalType> arguments;
+	child_list_t<LogicalType> entries;
+	auto order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	bool has_destructor = false;
+	for (auto &wexpr_ref : wexprs) {
+		auto &wexpr = wexpr_ref.get();
+		D_ASSERT(FramesAreShared(wexpr, *result));
+
+		//	Arguments that are used by several aggregates are only materialised once
+		vector<idx_t> columns;
+		for (auto &child : wexpr.children) {
+			idx_t column_idx = 0;
+			for (; column_idx < result->children.size(); ++column_idx) {
+				if (!child->IsVolatile() && child->Equals(*result->children[column_idx])) {
+					break;
+				}
+			}
+			if (column_idx == result->children.size()) {
+				arguments.emplace_back(child->return_type);
+				result->children.emplace_back(child->Copy());
+			}
+			columns.emplace_back(column_idx);
+		}
+		info->input_columns.emplace_back(std::move(columns));
+
+		info->aggregates.emplace_back(wexpr);
+		info->state_offsets.emplace_back(info->state_size);
+		info->state_size += info->aggregates.back().payload_size;
+
+		entries.emplace_back(to_string(entries.size()), wexpr.return_type);
+		if (wexpr.aggregate->order_dependent == AggregateOrderDependent::ORDER_DEPENDENT) {
+			order_dependent = AggregateOrderDependent::ORDER_DEPENDENT;
+		}
+		has_destructor = has_destructor || wexpr.aggregate->destructor;
+	}
+
+	result->return_type = LogicalType::STRUCT(std::move(entries));
+	AggregateFunction aggregate("shared_window_aggregate", arguments, result->return_type, SharedAggregateStateSize,
+	                            SharedAggregateInitialize, SharedAggregateUpdate, SharedAggregateCombine,
+	                            SharedAggregateFinalize, nullptr, nullptr,
+	                            has_destructor ? SharedAggregateDestructor : nullptr);
+	aggregate.order_dependent = order_dependent;
+	aggregate.function_info = info;
+	result->aggregate = make_uniq<AggregateFunction>(std::move(aggregate));
+	result->bind_info = make_uniq<WindowSharedAggregateData>(std::move(info));
+
+	return result;
+}
+
 //===--------------------------------------------------------------------===//
 // WindowRowNumberExecutor
 //===--------------------------------------------------------------------===//
@@ -20,13 +20,18 @@ namespace duckdb {
 WindowAggregatorState::WindowAggregatorState() : allocator(Allocator::DefaultAllocator()) {
 }
 
+WindowAggregatorState::WindowAggregatorState(Allocator &allocator) : allocator(allocator) {
+}
+
 class WindowAggregatorGlobalState : public WindowAggregatorState {
 public:
-	WindowAggregatorGlobalState(const WindowAggregator &aggregator_p, idx_t group_count)
-	    : aggregator(aggregator_p), winputs(inputs), locals(0), finalized(0) {
+	WindowAggregatorGlobalState(ClientContext &context, const WindowAggregator &aggregator_p, idx_t group_count)
+	    : WindowAggregatorState(BufferAllocator::Get(context, MemoryTag::WINDOW)),
+	      buffer_allocator(BufferAllocator::Get(context, MemoryTag::WINDOW)), aggregator(aggregator_p),
+	      winputs(inputs), locals(0), finalized(0) {
 
 		if (!aggregator.arg_types.empty()) {
-			winputs.Initialize(Allocator::DefaultAllocator(), aggregator.arg_types, group_count);
+			winputs.Initialize(buffer_allocator, aggregator.arg_types, group_count);
 		}
 		if (aggregator.aggr.filter) {
 			// 	Start with all invalid and set the ones that pass
@@ -34,6 +39,8 @@ public:
 		}
 	}
 
+	//! The allocator for the partition data and the aggregate states, which charges them to the WINDOW memory tag
+	Allocator &buffer_allocator;
 	//! The aggregator data
 	const WindowAggregator &aggregator;
 
@@ -63,8 +70,9 @@ WindowAggregator::WindowAggregator(AggregateObject aggr_p, const vector<LogicalT
 WindowAggregator::~WindowAggregator() {
 }
 
-unique_ptr<WindowAggregatorState> WindowAggregator::GetGlobalState(idx_t group_count, const ValidityMask &) const {
-	return make_uniq<WindowAggregatorGlobalState>(*this, group_count);
+unique_ptr<WindowAggregatorState> WindowAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
+                                                                   const ValidityMask &) const {
+	return make_uniq<WindowAggregatorGlobalState>(context, *this, group_count);
 }
 
 void WindowAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
@@ -89,23 +97,23 @@ void WindowAggregator::Finalize(WindowAggregatorState &gstate, WindowAggregatorS
 // WindowConstantAggregator
 //===--------------------------------------------------------------------===//
 struct WindowAggregateStates {
-	explicit WindowAggregateStates(const AggregateObject &aggr);
+	WindowAggregateStates(const AggregateObject &aggr, Allocator &allocator);
 	~WindowAggregateStates() {
 		Destroy();
 	}
 
 	//! The number of states
 	idx_t GetCount() const {
-		return states.size() / state_size;
+		return states.GetSize() / state_size;
 	}
 	data_ptr_t *GetData() {
 		return FlatVector::GetData<data_ptr_t>(*statef);
 	}
 	data_ptr_t GetStatePtr(idx_t idx) {
-		return states.data() + idx * state_size;
+		return states.get() + idx * state_size;
 	}
 	const_data_ptr_t GetStatePtr(idx_t idx) const {
-		return states.data() + idx * state_size;
+		return states.get() + idx * state_size;
 	}
 	//! Initialise all the states
 	void Initialize(idx_t count);
@@ -124,18 +132,20 @@ struct WindowAggregateStates {
 	//! The allocator to use
 	ArenaAllocator allocator;
 	//! Data pointer that contains the state data
-	vector<data_t> states;
+	AllocatedData states;
 	//! Reused result state container for the window functions
 	unique_ptr<Vector> statef;
 };
 
-WindowAggregateStates::WindowAggregateStates(const AggregateObject &aggr)
-    : aggr(aggr), state_size(aggr.function.state_size(aggr.function)), allocator(Allocator::DefaultAllocator()) {
+WindowAggregateStates::WindowAggregateStates(const AggregateObject &aggr, Allocator &allocator)
+    : aggr(aggr), state_size(aggr.function.state_size(aggr.function)), allocator(allocator) {
 }
 
 void WindowAggregateStates::Initialize(idx_t count) {
-	states.resize(count * state_size);
-	auto state_ptr = states.data();
+	if (count * state_size > 0) {
+		states = allocator.GetAllocator().Allocate(count * state_size);
+	}
+	auto state_ptr = states.get();
 
 	statef = make_uniq<Vector>(LogicalType::POINTER, count);
 	auto state_f_data = FlatVector::GetData<data_ptr_t>(*statef);
@@ -160,7 +170,7 @@ void WindowAggregateStates::Finalize(Vector &result) {
 }
 
 void WindowAggregateStates::Destroy() {
-	if (states.empty()) {
+	if (!states.IsSet()) {
 		return;
 	}
 
@@ -169,13 +179,13 @@ void WindowAggregateStates::Destroy() {
 		aggr.function.destructor(*statef, aggr_input_data, GetCount());
 	}
 
-	states.clear();
+	states.Reset();
 }
 
 class WindowConstantAggregatorGlobalState : public WindowAggregatorGlobalState {
 public:
-	WindowConstantAggregatorGlobalState(const WindowConstantAggregator &aggregator, idx_t count,
-	                                    const ValidityMask &partition_mask);
+	WindowConstantAggregatorGlobalState(ClientContext &context, const WindowConstantAggregator &aggregator,
+	                                    idx_t count, const ValidityMask &partition_mask);
 
 	void Finalize(const FrameStats &stats);
 
@@ -211,10 +221,12 @@ public:
 	SelectionVector matches;
 };
 
-WindowConstantAggregatorGlobalState::WindowConstantAggregatorGlobalState(const WindowConstantAggregator &aggregator,
+WindowConstantAggregatorGlobalState::WindowConstantAggregatorGlobalState(ClientContext &context,
+                                                                         const WindowConstantAggregator &aggregator,
                                                                          idx_t group_count,
                                                                          const ValidityMask &partition_mask)
-    : WindowAggregatorGlobalState(aggregator, STANDARD_VECTOR_SIZE), statef(aggregator.aggr) {
+    : WindowAggregatorGlobalState(context, aggregator, STANDARD_VECTOR_SIZE),
+      statef(aggregator.aggr, buffer_allocator) {
 
 	// Locate the partition boundaries
 	if (partition_mask.AllValid()) {
@@ -254,7 +266,7 @@ WindowConstantAggregatorGlobalState::WindowConstantAggregatorGlobalState(const W
 
 WindowConstantAggregatorLocalState::WindowConstantAggregatorLocalState(
     const WindowConstantAggregatorGlobalState &gstate)
-    : gstate(gstate), statep(Value::POINTER(0)), statef(gstate.statef.aggr), partition(0) {
+    : gstate(gstate), statep(Value::POINTER(0)), statef(gstate.statef.aggr, gstate.buffer_allocator), partition(0) {
 	matches.Initialize();
 
 	//	Start the aggregates
@@ -274,9 +286,9 @@ WindowConstantAggregator::WindowConstantAggregator(AggregateObject aggr, const v
     : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode_p) {
 }
 
-unique_ptr<WindowAggregatorState> WindowConstantAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowConstantAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                            const ValidityMask &partition_mask) const {
-	return make_uniq<WindowConstantAggregatorGlobalState>(*this, group_count, partition_mask);
+	return make_uniq<WindowConstantAggregatorGlobalState>(context, *this, group_count, partition_mask);
 }
 
 void WindowConstantAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
@@ -472,8 +484,9 @@ static void InitSubFrames(SubFrames &frames, const WindowExcludeMode exclude_mod
 
 class WindowCustomAggregatorGlobalState : public WindowAggregatorGlobalState {
 public:
-	explicit WindowCustomAggregatorGlobalState(const WindowCustomAggregator &aggregator, idx_t group_count)
-	    : WindowAggregatorGlobalState(aggregator, group_count) {
+	WindowCustomAggregatorGlobalState(ClientContext &context, const WindowCustomAggregator &aggregator,
+	                                  idx_t group_count)
+	    : WindowAggregatorGlobalState(context, aggregator, group_count) {
 
 		gcstate = make_uniq<WindowCustomAggregatorState>(aggregator.aggr, aggregator.exclude_mode);
 	}
@@ -503,9 +516,9 @@ WindowCustomAggregatorState::~WindowCustomAggregatorState() {
 	}
 }
 
-unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowCustomAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                          const ValidityMask &) const {
-	return make_uniq<WindowCustomAggregatorGlobalState>(*this, group_count);
+	return make_uniq<WindowCustomAggregatorGlobalState>(context, *this, group_count);
 }
 
 void WindowCustomAggregator::Finalize(WindowAggregatorState &gsink, WindowAggregatorState &lstate,
@@ -827,11 +840,11 @@ class WindowSegmentTreeGlobalState : public WindowAggregatorGlobalState {
 public:
 	using AtomicCounters = vector<std::atomic<idx_t>>;
 
-	WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count);
+	WindowSegmentTreeGlobalState(ClientContext &context, const WindowSegmentTree &aggregator, idx_t group_count);
 
 	ArenaAllocator &CreateTreeAllocator() {
 		lock_guard<mutex> tree_lock(lock);
-		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
+		tree_allocators.emplace_back(make_uniq<ArenaAllocator>(buffer_allocator));
 		return *tree_allocators.back();
 	}
 
@@ -986,9 +999,9 @@ WindowSegmentTreePart::WindowSegmentTreePart(ArenaAllocator &allocator, const Ag
 WindowSegmentTreePart::~WindowSegmentTreePart() {
 }
 
-unique_ptr<WindowAggregatorState> WindowSegmentTree::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowSegmentTree::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                     const ValidityMask &partition_mask) const {
-	return make_uniq<WindowSegmentTreeGlobalState>(*this, group_count);
+	return make_uniq<WindowSegmentTreeGlobalState>(context, *this, group_count);
 }
 
 unique_ptr<WindowAggregatorState> WindowSegmentTree::GetLocalState(const WindowAggregatorState &gstate) const {
@@ -1082,8 +1095,10 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 	}
 }
 
-WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(const WindowSegmentTree &aggregator, idx_t group_count)
-    : WindowAggregatorGlobalState(aggregator, group_count), tree(aggregator), levels_flat_native(aggregator.aggr) {
+WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(ClientContext &context, const WindowSegmentTree &aggregator,
+                                                           idx_t group_count)
+    : WindowAggregatorGlobalState(context, aggregator, group_count), tree(aggregator),
+      levels_flat_native(aggregator.aggr, buffer_allocator) {
 
 	D_ASSERT(inputs.ColumnCount() > 0);
 
@@ -1433,7 +1448,8 @@ public:
 	using ZippedTuple = WindowDistinctSortTree::ZippedTuple;
 	using ZippedElements = WindowDistinctSortTree::ZippedElements;
 
-	WindowDistinctAggregatorGlobalState(const WindowDistinctAggregator &aggregator, idx_t group_count);
+	WindowDistinctAggregatorGlobalState(ClientContext &context, const WindowDistinctAggregator &aggregator,
+	                                    idx_t group_count);
 
 	//! Compute the block starts
 	void MeasurePayloadBlocks();
@@ -1479,11 +1495,12 @@ public:
 	vector<idx_t> levels_flat_start;
 };
 
-WindowDistinctAggregatorGlobalState::WindowDistinctAggregatorGlobalState(const WindowDistinctAggregator &aggregator,
+WindowDistinctAggregatorGlobalState::WindowDistinctAggregatorGlobalState(ClientContext &context,
+                                                                         const WindowDistinctAggregator &aggregator,
                                                                          idx_t group_count)
-    : WindowAggregatorGlobalState(aggregator, group_count), context(aggregator.context),
+    : WindowAggregatorGlobalState(context, aggregator, group_count), context(aggregator.context),
       stage(PartitionSortStage::INIT), tasks_completed(0), merge_sort_tree(*this, group_count),
-      levels_flat_native(aggregator.aggr) {
+      levels_flat_native(aggregator.aggr, buffer_allocator) {
 	payload_types.emplace_back(LogicalType::UBIGINT);
 
 	//	1:	functionComputePrevIdcs(𝑖𝑛)
@@ -1584,7 +1601,8 @@ protected:
 WindowDistinctAggregatorLocalState::WindowDistinctAggregatorLocalState(
     const WindowDistinctAggregatorGlobalState &gastate)
     : update_v(LogicalType::POINTER), source_v(LogicalType::POINTER), target_v(LogicalType::POINTER), gastate(gastate),
-      statef(gastate.aggregator.aggr), statep(LogicalType::POINTER), statel(LogicalType::POINTER), flush_count(0) {
+      statef(gastate.aggregator.aggr, gastate.buffer_allocator), statep(LogicalType::POINTER),
+      statel(LogicalType::POINTER), flush_count(0) {
 	InitSubFrames(frames, gastate.aggregator.exclude_mode);
 	payload_chunk.Initialize(Allocator::DefaultAllocator(), gastate.payload_types);
 
@@ -1601,9 +1619,9 @@ WindowDistinctAggregatorLocalState::WindowDistinctAggregatorLocalState(
 	gastate.locals++;
 }
 
-unique_ptr<WindowAggregatorState> WindowDistinctAggregator::GetGlobalState(idx_t group_count,
+unique_ptr<WindowAggregatorState> WindowDistinctAggregator::GetGlobalState(ClientContext &context, idx_t group_count,
                                                                            const ValidityMask &partition_mask) const {
-	return make_uniq<WindowDistinctAggregatorGlobalState>(*this, group_count);
+	return make_uniq<WindowDistinctAggregatorGlobalState>(context, *this, group_count);
 }
 
 void WindowDistinctAggregator::Sink(WindowAggregatorState &gsink, WindowAggregatorState &lstate, DataChunk &arg_chunk,
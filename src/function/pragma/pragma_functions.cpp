@@ -8,6 +8,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
@@ -122,6 +123,63 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaCreateResourceGroup(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	if (name.empty()) {
+		throw InvalidInputException("Resource group name cannot be empty");
+	}
+	optional_idx max_threads;
+	optional_idx max_memory;
+	idx_t weight = 1;
+	bool replace = false;
+	for (auto &entry : parameters.named_parameters) {
+		if (entry.first == "max_threads") {
+			auto value = entry.second.GetValue<int64_t>();
+			if (value < 1) {
+				throw InvalidInputException("max_threads of a resource group must be at least 1");
+			}
+			max_threads = NumericCast<idx_t>(value);
+		} else if (entry.first == "max_memory") {
+			max_memory = DBConfig::ParseMemoryLimit(entry.second.ToString());
+		} else if (entry.first == "weight") {
+			auto value = entry.second.GetValue<int64_t>();
+			if (value < 1) {
+				throw InvalidInputException("weight of a resource group must be at least 1");
+			}
+			weight = NumericCast<idx_t>(value);
+		} else if (entry.first == "replace") {
+			replace = BooleanValue::Get(entry.second);
+		}
+	}
+	auto &resource_groups = TaskScheduler::GetScheduler(context).GetResourceGroupManager();
+	resource_groups.CreateGroup(make_shared_ptr<ResourceGroup>(name, max_threads, max_memory, weight), replace);
+}
+
+static void PragmaDropResourceGroup(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	auto if_exists = false;
+	auto entry = parameters.named_parameters.find("if_exists");
+	if (entry != parameters.named_parameters.end()) {
+		if_exists = BooleanValue::Get(entry->second);
+	}
+	TaskScheduler::GetScheduler(context).GetResourceGroupManager().DropGroup(name, if_exists);
+}
+
+void RegisterResourceGroupFunctions(BuiltinFunctions &set) {
+	auto create_group =
+	    PragmaFunction::PragmaCall("create_resource_group", PragmaCreateResourceGroup, {LogicalType::VARCHAR});
+	create_group.named_parameters["max_threads"] = LogicalType::BIGINT;
+	create_group.named_parameters["max_memory"] = LogicalType::VARCHAR;
+	create_group.named_parameters["weight"] = LogicalType::BIGINT;
+	create_group.named_parameters["replace"] = LogicalType::BOOLEAN;
+	set.AddFunction(create_group);
+
+	auto drop_group =
+	    PragmaFunction::PragmaCall("drop_resource_group", PragmaDropResourceGroup, {LogicalType::VARCHAR});
+	drop_group.named_parameters["if_exists"] = LogicalType::BOOLEAN;
+	set.AddFunction(drop_group);
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -160,6 +218,8 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_checkpoint_on_shutdown", PragmaEnableCheckpointOnShutdown));
 	set.AddFunction(
 	    PragmaFunction::PragmaStatement("disable_checkpoint_on_shutdown", PragmaDisableCheckpointOnShutdown));
+
+	RegisterResourceGroupFunctions(set);
 }
 
 } // namespace duckdb
@@ -0,0 +1,134 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+namespace duckdb {
+
+struct CheckpointInformation {
+	string database_name;
+	CheckpointHistoryEntry entry;
+};
+
+struct DuckDBCheckpointsData : public GlobalTableFunctionState {
+	DuckDBCheckpointsData() : offset(0) {
+	}
+
+	vector<CheckpointInformation> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBCheckpointsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("database_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("trigger");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("start_time");
+	return_types.emplace_back(LogicalType::TIMESTAMP);
+
+	names.emplace_back("wal_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("duration");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("commit_stall");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("error");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBCheckpointsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBCheckpointsData>();
+
+	auto &db_manager = DatabaseManager::Get(context);
+	for (auto &db_ref : db_manager.GetDatabases(context)) {
+		auto &db = db_ref.get();
+		if (db.IsSystem() || !db.GetTransactionManager().IsDuckTransactionManager()) {
+			continue;
+		}
+		auto &transaction_manager = DuckTransactionManager::Get(db);
+		for (auto &entry : transaction_manager.GetCheckpointHistory()) {
+			CheckpointInformation info;
+			info.database_name = db.GetName();
+			info.entry = entry;
+			result->entries.push_back(std::move(info));
+		}
+	}
+	return std::move(result);
+}
+
+static const char *CheckpointTriggerToString(CheckpointTrigger trigger) {
+	switch (trigger) {
+	case CheckpointTrigger::MANUAL:
+		return "MANUAL";
+	case CheckpointTrigger::COMMIT:
+		return "COMMIT";
+	case CheckpointTrigger::BACKGROUND:
+		return "BACKGROUND";
+	default:
+		throw InternalException("Unsupported checkpoint trigger");
+	}
+}
+
+static const char *CheckpointTypeToString(CheckpointType type) {
+	switch (type) {
+	case CheckpointType::FULL_CHECKPOINT:
+		return "FULL";
+	case CheckpointType::CONCURRENT_CHECKPOINT:
+		return "CONCURRENT";
+	default:
+		throw InternalException("Unsupported checkpoint type");
+	}
+}
+
+void DuckDBCheckpointsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBCheckpointsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &info = data.entries[data.offset++];
+		auto &entry = info.entry;
+		// return values:
+		idx_t col = 0;
+		// database_name, VARCHAR
+		output.SetValue(col++, count, info.database_name);
+		// trigger, VARCHAR
+		output.SetValue(col++, count, Value(CheckpointTriggerToString(entry.trigger)));
+		// type, VARCHAR
+		output.SetValue(col++, count, Value(CheckpointTypeToString(entry.type)));
+		// start_time, TIMESTAMP
+		output.SetValue(col++, count, Value::TIMESTAMP(entry.start_time));
+		// wal_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.wal_size)));
+		// duration, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.duration));
+		// commit_stall, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.commit_stall));
+		// error, VARCHAR
+		output.SetValue(col++, count, entry.error.empty() ? Value() : Value(entry.error));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBCheckpointsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_checkpoints", {}, DuckDBCheckpointsFunction, DuckDBCheckpointsBind, DuckDBCheckpointsInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,101 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/parallel/resource_group.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBResourceGroupsData : public GlobalTableFunctionState {
+	DuckDBResourceGroupsData() : offset(0) {
+	}
+
+	vector<shared_ptr<ResourceGroup>> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBResourceGroupsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("max_threads");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("max_memory_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("weight");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("active_queries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("total_queries");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("thread_limit");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_reservation_bytes");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBResourceGroupsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBResourceGroupsData>();
+
+	result->entries = TaskScheduler::GetScheduler(context).GetResourceGroupManager().GetGroups();
+	return std::move(result);
+}
+
+static Value OptionalBigIntValue(const optional_idx &value) {
+	if (!value.IsValid()) {
+		return Value(LogicalType::BIGINT);
+	}
+	return Value::BIGINT(NumericCast<int64_t>(value.GetIndex()));
+}
+
+void DuckDBResourceGroupsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBResourceGroupsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto &resource_groups = scheduler.GetResourceGroupManager();
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = *data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// name, VARCHAR
+		output.SetValue(col++, count, Value(entry.name));
+		// max_threads, BIGINT
+		output.SetValue(col++, count, OptionalBigIntValue(entry.max_threads));
+		// max_memory_bytes, BIGINT
+		output.SetValue(col++, count, OptionalBigIntValue(entry.max_memory));
+		// weight, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.weight)));
+		// active_queries, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.active_queries.load())));
+		// total_queries, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.total_queries.load())));
+		// thread_limit, BIGINT
+		auto thread_limit = resource_groups.GetThreadLimit(entry, thread_count);
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(thread_limit)));
+		// memory_reservation_bytes, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.memory_reservation.load())));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBResourceGroupsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_resource_groups", {}, DuckDBResourceGroupsFunction, DuckDBResourceGroupsBind,
+	                              DuckDBResourceGroupsInit));
+}
+
+} // namespace duckdb
@@ -19,6 +19,21 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("slot_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("block_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("uncompressed_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("compression_ratio");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("compression_throughput");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
 	return nullptr;
 }
 
@@ -42,10 +57,27 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		auto &entry = data.entries[data.offset++];
 		// return values:
 		idx_t col = 0;
-		// database_name, VARCHAR
+		// path, VARCHAR
 		output.SetValue(col++, count, entry.path);
-		// database_oid, BIGINT
+		// size, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// slot_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.slot_size)));
+		// block_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.block_count)));
+		// uncompressed_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.uncompressed_size)));
+		// compression_ratio, DOUBLE
+		auto stored_size = entry.block_count * entry.slot_size;
+		output.SetValue(col++, count,
+		                stored_size == 0 ? Value()
+		                                 : Value::DOUBLE(double(entry.uncompressed_size) / double(stored_size)));
+		// compression_throughput (MiB/s), DOUBLE
+		output.SetValue(col++, count,
+		                entry.compression_time == 0
+		                    ? Value()
+		                    : Value::DOUBLE(double(entry.compression_input_bytes) / (1024.0 * 1024.0) /
+		                                    (double(entry.compression_time) / 1e9)));
 		count++;
 	}
 	output.SetCardinality(count);
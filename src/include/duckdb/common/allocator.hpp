@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/helper.hpp"
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/shared_ptr.hpp"
@@ -123,6 +124,13 @@ public:
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
 
+	//! The size of a (transparent) huge page
+	static constexpr const idx_t HUGE_PAGE_SIZE = 2097152ULL;
+	//! Advise the OS to back the given allocation with huge pages, which reduces TLB misses for random accesses into
+	//! large allocations. Only the huge-page-aligned part of the allocation can be backed by huge pages.
+	//! Returns true if the advice was given.
+	DUCKDB_API static bool AdviseHugePages(data_ptr_t pointer, idx_t size);
+
 private:
 	allocate_function_ptr_t allocate_function;
 	free_function_ptr_t free_function;
@@ -158,10 +166,13 @@ void DestroyObject(T *ptr) {
 //! other blocks to make space in memory.
 //! Note that there is a cost to doing so (several atomic operations will be performed on allocation/free).
 //! As such this class should be used primarily for larger allocations.
+//! Allocations are charged to the ALLOCATOR memory tag, unless another tag is specified.
 struct BufferAllocator {
 	DUCKDB_API static Allocator &Get(ClientContext &context);
 	DUCKDB_API static Allocator &Get(DatabaseInstance &db);
 	DUCKDB_API static Allocator &Get(AttachedDatabase &db);
+	DUCKDB_API static Allocator &Get(ClientContext &context, MemoryTag tag);
+	DUCKDB_API static Allocator &Get(DatabaseInstance &db, MemoryTag tag);
 };
 
 } // namespace duckdb
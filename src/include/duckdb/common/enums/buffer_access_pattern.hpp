@@ -0,0 +1,20 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_access_pattern.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+enum class BufferAccessPattern : uint8_t {
+	RANDOM = 0,    //! The block is accessed directly, e.g., by a point lookup (re-accessing it marks the block as hot)
+	SEQUENTIAL = 1 //! The block is accessed as part of a sequential scan (does not mark the block as hot)
+};
+
+} // namespace duckdb
@@ -35,4 +35,13 @@ enum class CheckpointType {
 	CONCURRENT_CHECKPOINT
 };
 
+enum class CheckpointTrigger {
+	//! The checkpoint was explicitly requested (i.e. through CHECKPOINT or FORCE CHECKPOINT)
+	MANUAL,
+	//! The checkpoint was performed by a committing transaction because the WAL exceeded the checkpoint threshold
+	COMMIT,
+	//! The checkpoint was performed by the background checkpointer because the WAL exceeded the checkpoint threshold
+	BACKGROUND
+};
+
 } // namespace duckdb
@@ -0,0 +1,18 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/temporary_file_compression.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The compression that is applied to blocks that are offloaded to the temporary directory
+enum class TemporaryFileCompression : uint8_t { NONE = 0, LZ4 = 1 };
+
+} // namespace duckdb
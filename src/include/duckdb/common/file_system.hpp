@@ -51,6 +51,33 @@ enum class FileType {
 	FILE_TYPE_INVALID,
 };
 
+//! A request to read nr_bytes from the specified location of a file into the buffer
+struct FileReadRequest {
+	FileReadRequest(void *buffer, idx_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	void *buffer;
+	idx_t nr_bytes;
+	idx_t location;
+};
+
+//! A private memory mapping of the first size bytes of a file. Writes to the mapped memory are copy-on-write and are
+//! never written back to the file. The mapping is released when it is destroyed.
+struct FileMemoryMapping {
+	FileMemoryMapping(data_ptr_t data, idx_t size) : data(data), size(size) {
+	}
+	DUCKDB_API virtual ~FileMemoryMapping() {
+	}
+
+	//! Release the memory of a (page-aligned) range of the mapping - the range is read from the file again on access
+	DUCKDB_API virtual void Release(data_ptr_t range, idx_t range_size) {
+	}
+
+	data_ptr_t data;
+	idx_t size;
+};
+
 struct FileHandle {
 public:
 	DUCKDB_API FileHandle(FileSystem &file_system, string path);
@@ -60,6 +87,7 @@ public:
 	DUCKDB_API int64_t Read(void *buffer, idx_t nr_bytes);
 	DUCKDB_API int64_t Write(void *buffer, idx_t nr_bytes);
 	DUCKDB_API void Read(void *buffer, idx_t nr_bytes, idx_t location);
+	DUCKDB_API void ReadBatch(vector<FileReadRequest> &requests);
 	DUCKDB_API void Write(void *buffer, idx_t nr_bytes, idx_t location);
 	DUCKDB_API void Seek(idx_t location);
 	DUCKDB_API void Reset();
@@ -115,6 +143,12 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	DUCKDB_API virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Perform a set of positional reads. Fails if any of the reads could not be completed. The reads are independent,
+	//! and file systems can have them in flight concurrently.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests);
+	//! Map the first size bytes of the file into memory (copy-on-write). Returns nullptr if the file system does not
+	//! support memory-mapping the file, in which case the file has to be read instead.
+	DUCKDB_API virtual unique_ptr<FileMemoryMapping> MapFile(FileHandle &handle, idx_t size);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
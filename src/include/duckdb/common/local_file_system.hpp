@@ -21,6 +21,11 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	//! Perform a set of positional reads. On Linux the reads are submitted together through io_uring, falling back to
+	//! pread if io_uring is not available.
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
+	//! Map the first size bytes of the file into memory using mmap. Not supported on Windows.
+	unique_ptr<FileMemoryMapping> MapFile(FileHandle &handle, idx_t size) override;
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa_topology.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! The NumaTopology describes which CPUs belong to which NUMA node of the system
+class NumaTopology {
+public:
+	//! Detects the NUMA topology of the system - falls back to a single node if it cannot be detected
+	static NumaTopology Detect(FileSystem &fs);
+	//! Parses a CPU list in the format of the Linux sysfs (e.g. "0-3,8,10-11") - returns an empty list if it is malformed
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+
+	//! The largest CPU id we accept in a CPU list
+	static constexpr idx_t MAX_CPU_ID = 65535;
+
+	//! The number of NUMA nodes
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+	//! The CPUs that belong to the given node - empty if they are unknown
+	const vector<idx_t> &GetNodeCPUs(idx_t node) const {
+		return node_cpus[node];
+	}
+	//! Returns the node of the given CPU - returns 0 if the CPU is unknown
+	idx_t GetNodeOfCPU(idx_t cpu_id) const {
+		return cpu_id < cpu_nodes.size() ? cpu_nodes[cpu_id] : 0;
+	}
+
+private:
+	NumaTopology();
+
+	void AddNode(vector<idx_t> cpus);
+
+private:
+	//! The CPUs of each node
+	vector<vector<idx_t>> node_cpus;
+	//! The node of each CPU
+	vector<idx_t> cpu_nodes;
+};
+
+} // namespace duckdb
@@ -34,6 +34,14 @@ public:
 		GetFileSystem().Read(handle, buffer, nr_bytes, location);
 	};
 
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override {
+		GetFileSystem().ReadBatch(handle, requests);
+	}
+
+	unique_ptr<FileMemoryMapping> MapFile(FileHandle &handle, idx_t size) override {
+		return GetFileSystem().MapFile(handle, size);
+	}
+
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
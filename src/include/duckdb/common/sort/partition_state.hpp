@@ -36,7 +36,8 @@ public:
 		return part_cmp;
 	}
 
-	void ComputeMasks(ValidityMask &partition_mask, OrderMasks &order_masks);
+	//! Compute the partition and order boundaries of the rows in [begin, end)
+	void ComputeMasks(ValidityMask &partition_mask, OrderMasks &order_masks, idx_t begin, idx_t end);
 
 	GlobalSortStatePtr global_sort;
 	atomic<idx_t> count;
@@ -223,7 +224,8 @@ public:
 
 	using PartitionGlobalMergeStatePtr = unique_ptr<PartitionGlobalMergeState>;
 
-	explicit PartitionGlobalMergeStates(PartitionGlobalSinkState &sink);
+	//! Sort the hash bins that are set in bins, or all of them if bins is empty
+	explicit PartitionGlobalMergeStates(PartitionGlobalSinkState &sink, const vector<bool> &bins = vector<bool>());
 
 	bool ExecuteTask(PartitionLocalMergeState &local_state, Callback &callback);
 
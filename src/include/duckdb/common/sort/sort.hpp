@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! The maximum number of sorted blocks that are merged into one by a single k-way merge
+	static constexpr idx_t MERGE_FAN_IN = 16;
 };
 
 struct SortLayout {
@@ -60,8 +62,10 @@ public:
 	//! Prepares the GlobalSortState for the merge sort phase (after completing radix sort phase)
 	void PrepareMergePhase();
 	//! Initializes the global sort state for another round of merging
+	//! The sorted blocks are divided into groups of at most SortConstants::MERGE_FAN_IN blocks, the blocks in each
+	//! group are merged into a single block
 	void InitializeMergeRound();
-	//! Completes the cascaded merge sort round.
+	//! Completes the merge sort round.
 	//! Pass true if you wish to use the radix data for further comparisons.
 	void CompleteMergeRound(bool keep_radix_data = false);
 	//! Print the sorted data to the console.
@@ -80,7 +84,6 @@ public:
 	//! Sorted data
 	vector<unique_ptr<SortedBlock>> sorted_blocks;
 	vector<vector<unique_ptr<SortedBlock>>> sorted_blocks_temp;
-	unique_ptr<SortedBlock> odd_one_out;
 
 	//! Pinned heap data (if sorting in memory)
 	vector<unique_ptr<RowDataBlock>> heap_blocks;
@@ -92,10 +95,20 @@ public:
 	bool external;
 
 	//! Progress in merge path stage
-	idx_t pair_idx;
-	idx_t num_pairs;
-	idx_t l_start;
-	idx_t r_start;
+	//! Group i consists of the sorted blocks in [group_offsets[i], group_offsets[i + 1])
+	vector<idx_t> group_offsets;
+	idx_t group_idx;
+	//! The start of the next partition within each of the sorted blocks of the current group
+	vector<idx_t> run_starts;
+
+	//! Returns the number of groups that are merged in the current round
+	idx_t GroupCount() const {
+		return group_offsets.empty() ? 0 : group_offsets.size() - 1;
+	}
+	//! Returns the number of sorted blocks in the given group
+	idx_t GroupSize(idx_t group) const {
+		return group_offsets[group + 1] - group_offsets[group];
+	}
 };
 
 struct LocalSortState {
@@ -147,11 +160,14 @@ private:
 	Vector addresses = Vector(LogicalType::POINTER);
 };
 
+//! The MergeSorter merges groups of sorted blocks with a k-way merge. Each group is divided into partitions that
+//! produce exactly GlobalSortState::block_capacity rows (Merge Path generalized to k sorted blocks), which are merged in
+//! parallel. The next row of a partition is selected using a tournament (loser) tree over the sorted blocks.
 struct MergeSorter {
 public:
 	MergeSorter(GlobalSortState &state, BufferManager &buffer_manager);
 
-	//! Finds and merges partitions until the current cascaded merge round is finished
+	//! Finds and merges partitions until the current merge round is finished
 	void PerformInMergeRound();
 
 private:
@@ -161,47 +177,44 @@ private:
 	BufferManager &buffer_manager;
 	const SortLayout &sort_layout;
 
-	//! The left and right reader
-	unique_ptr<SBScanState> left;
-	unique_ptr<SBScanState> right;
+	//! The readers of the sorted blocks that are merged
+	vector<unique_ptr<SBScanState>> scanners;
 
 	//! Input and output blocks
-	unique_ptr<SortedBlock> left_input;
-	unique_ptr<SortedBlock> right_input;
+	vector<unique_ptr<SortedBlock>> inputs;
 	SortedBlock *result;
 
+	//! The loser tree: tree[0] holds the index of the winning reader, the other nodes hold the loser of their match
+	vector<idx_t> tree;
+	//! Scratch space to build the loser tree
+	vector<idx_t> winners;
+	//! Radix pointers to the current entry of each reader, and whether the reader is exhausted
+	vector<data_ptr_t> heads;
+	vector<bool> exhausted;
+
 private:
-	//! Computes the left and right block that will be merged next (Merge Path partition)
+	//! Computes the sorted blocks and the ranges within them that will be merged next (Merge Path partition)
 	void GetNextPartition();
-	//! Finds the boundary of the next partition using binary search
-	void GetIntersection(const idx_t diagonal, idx_t &l_idx, idx_t &r_idx);
-	//! Compare values within SortedBlocks using a global index
-	int CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx);
+	//! Finds the end of the next partition within each of the sorted blocks
+	void GetIntersection(const idx_t diagonal, const vector<idx_t> &starts, vector<idx_t> &ends);
+	//! Compare values within SortedBlocks using a global index, ties are broken by the index of the reader
+	int CompareUsingGlobalIndex(idx_t l_reader, idx_t r_reader, const idx_t l_idx, const idx_t r_idx);
 
 	//! Finds the next partition and merges it
 	void MergePartition();
 
-	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
-	void ComputeMerge(const idx_t &count, bool left_smaller[]);
-
-	//! Merges the radix sorting blocks according to the 'left_smaller' array
-	void MergeRadix(const idx_t &count, const bool left_smaller[]);
-	//! Merges SortedData according to the 'left_smaller' array
-	void MergeData(SortedData &result_data, SortedData &l_data, SortedData &r_data, const idx_t &count,
-	               const bool left_smaller[], idx_t next_entry_sizes[], bool reset_indices);
-	//! Merges constant size rows according to the 'left_smaller' array
-	void MergeRows(data_ptr_t &l_ptr, idx_t &l_entry_idx, const idx_t &l_count, data_ptr_t &r_ptr, idx_t &r_entry_idx,
-	               const idx_t &r_count, RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size,
-	               const bool left_smaller[], idx_t &copied, const idx_t &count);
-	//! Flushes constant size rows into the result
-	void FlushRows(data_ptr_t &source_ptr, idx_t &source_entry_idx, const idx_t &source_count,
-	               RowDataBlock &target_block, data_ptr_t &target_ptr, const idx_t &entry_size, idx_t &copied,
-	               const idx_t &count);
-	//! Flushes blob rows and accompanying heap
-	void FlushBlobs(const RowLayout &layout, const idx_t &source_count, data_ptr_t &source_data_ptr,
-	                idx_t &source_entry_idx, data_ptr_t &source_heap_ptr, RowDataBlock &target_data_block,
-	                data_ptr_t &target_data_ptr, RowDataBlock &target_heap_block, BufferHandle &target_heap_handle,
-	                data_ptr_t &target_heap_ptr, idx_t &copied, const idx_t &count);
+	//! Compares the current entries of two readers, ties are broken by the index of the reader
+	bool HeadIsSmaller(idx_t l_reader, idx_t r_reader);
+	//! Moves the reader to its next entry, and pins the blocks it points to
+	void AdvanceHead(idx_t reader);
+	//! Computes how the next 'count' tuples should be merged by setting the 'sources' array
+	void ComputeMerge(const idx_t &count, idx_t sources[]);
+
+	//! Merges the radix sorting blocks according to the 'sources' array
+	void MergeRadix(const idx_t &count, const idx_t sources[]);
+	//! Merges SortedData according to the 'sources' array
+	void MergeData(SortedData &result_data, SortedDataType type, const idx_t &count, const idx_t sources[],
+	               bool reset_indices);
 };
 
 struct SBIterator {
@@ -22,6 +22,8 @@ public:
 
 	DUCKDB_API void Destroy();
 	DUCKDB_API void Move(StringHeap &other);
+	//! Releases all strings in the heap, but keeps the most recently allocated arena chunk around for reuse
+	DUCKDB_API void Reset();
 
 	//! Add a string to the string heap, returns a pointer to the string
 	DUCKDB_API string_t AddString(const char *data, idx_t len);
@@ -165,6 +165,10 @@ private:
 };
 
 class VectorStringBuffer : public VectorBuffer {
+public:
+	//! String buffers with a heap larger than this are not reused by TryReset
+	static constexpr const idx_t MAXIMUM_REUSE_SIZE = 1048576ULL;
+
 public:
 	VectorStringBuffer();
 	explicit VectorStringBuffer(VectorBufferType type);
@@ -187,6 +191,10 @@ public:
 		references.push_back(std::move(heap));
 	}
 
+	//! Releases all strings of the buffer so that it can be reused for the strings of the next chunk, without going
+	//! through the allocator again. Returns false if the buffer should not be reused (it must then be destroyed).
+	bool TryReset();
+
 private:
 	//! The string heap of this buffer
 	StringHeap heap;
@@ -23,6 +23,8 @@ public:
 	                                optional_ptr<FileOpener> opener = nullptr) override;
 
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
+	unique_ptr<FileMemoryMapping> MapFile(FileHandle &handle, idx_t size) override;
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
 
 	int64_t Read(FileHandle &handle, void *buffer, int64_t nr_bytes) override;
@@ -14,6 +14,9 @@
 namespace duckdb {
 
 struct QuantileOperation {
+	//! Skip lists are only used for frames that cover less than 1/MAX_SKIP_COVER of the partition
+	static constexpr idx_t MAX_SKIP_COVER = 16;
+
 	template <class STATE>
 	static void Initialize(STATE &state) {
 		new (&state) STATE();
@@ -60,12 +63,14 @@ struct QuantileOperation {
 		const auto &stats = partition.stats;
 
 		//	If frames overlap significantly, then use local skip lists.
+		//	Each thread rebuilds its skip list from scratch when it starts on a new range of rows,
+		//	so frames that cover a large part of the partition are cheaper to answer from the tree.
 		if (stats[0].end <= stats[1].begin) {
 			//	Frames can overlap
 			const auto overlap = double(stats[1].begin - stats[0].end);
-			const auto cover = double(stats[1].end - stats[0].begin);
-			const auto ratio = overlap / cover;
-			if (ratio > .75) {
+			const auto cover = UnsafeNumericCast<idx_t>(stats[1].end - stats[0].begin);
+			const auto ratio = overlap / double(cover);
+			if (ratio > .75 && cover * MAX_SKIP_COVER < count) {
 				return;
 			}
 		}
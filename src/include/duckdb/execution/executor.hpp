@@ -25,6 +25,7 @@ class PhysicalOperator;
 class PipelineExecutor;
 class OperatorState;
 class QueryProfiler;
+class ResourceGroupQuery;
 class ThreadContext;
 class Task;
 
@@ -93,6 +94,8 @@ public:
 	ProducerToken &GetToken() {
 		return *producer;
 	}
+	//! Returns the maximum amount of threads that a parallel pipeline of this query may use
+	idx_t GetThreadLimit();
 	void AddEvent(shared_ptr<Event> event);
 
 	void AddRecursiveCTE(PhysicalOperator &rec_cte);
@@ -161,6 +164,8 @@ private:
 	idx_t root_pipeline_idx;
 	//! The producer of this query
 	unique_ptr<ProducerToken> producer;
+	//! The registration of this query with its resource group (if any)
+	unique_ptr<ResourceGroupQuery> resource_group_query;
 	//! List of events
 	vector<shared_ptr<Event>> events;
 	//! The query profiler
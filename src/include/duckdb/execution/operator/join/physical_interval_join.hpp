@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_interval_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalIntervalJoin represents an interval overlap join between two tables,
+//! e.g. (lhs.begin <= rhs.end AND rhs.begin <= lhs.end).
+//! The RHS intervals are sorted by their start and indexed with a tree of their maximum ends,
+//! so every LHS interval only visits the subtrees that contain matches.
+class PhysicalIntervalJoin : public PhysicalComparisonJoin {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INTERVAL_JOIN;
+
+public:
+	PhysicalIntervalJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	                     vector<JoinCondition> cond, JoinType join_type, idx_t estimated_cardinality);
+
+	//! The type of all the interval bounds
+	LogicalType key_type;
+	//! The condition that bounds the RHS interval starts from above (lhs >= rhs.start)
+	idx_t start_cond;
+	//! The condition that bounds the RHS interval ends from below (lhs <= rhs.end)
+	idx_t end_cond;
+
+public:
+	// Operator Interface
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+protected:
+	// CachingOperator Interface
+	OperatorResultType ExecuteInternal(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                                   GlobalOperatorState &gstate, OperatorState &state) const override;
+
+public:
+	// Sink Interface
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+	                          OperatorSinkFinalizeInput &input) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+	bool ParallelSink() const override {
+		return true;
+	}
+
+	//! Whether the conditions describe an overlap between an LHS and an RHS interval that we can index
+	static bool IsSupported(const vector<JoinCondition> &conditions, JoinType join_type,
+	                        const vector<LogicalType> &rhs_types);
+	//! Whether the estimated RHS rows and their index fit in memory, as the index keeps them pinned while probing
+	static bool FitsInMemory(ClientContext &context, const vector<JoinCondition> &conditions,
+	                         const PhysicalOperator &rhs);
+};
+
+} // namespace duckdb
@@ -228,6 +228,20 @@ protected:
 	                      idx_t count, idx_t row_idx) const override;
 };
 
+//! Combines window aggregates with identical partitions, orders, frames and filters into a single aggregate.
+//! The states of the aggregates are laid out next to each other, so the frame boundaries are computed once
+//! and a single segment tree is built and probed for all of them.
+//! The combined aggregate returns a STRUCT with one entry per aggregate.
+class WindowSharedAggregate {
+public:
+	//! Whether the aggregate can be evaluated together with other aggregates
+	static bool CanShare(const BoundWindowExpression &wexpr, ClientContext &context, WindowAggregationMode mode);
+	//! Whether two aggregates have identical partitions, orders, frames and filters
+	static bool FramesAreShared(const BoundWindowExpression &lhs, const BoundWindowExpression &rhs);
+	//! Creates the window expression that evaluates all the given aggregates
+	static unique_ptr<BoundWindowExpression> Create(const vector<reference<BoundWindowExpression>> &wexprs);
+};
+
 class WindowRowNumberExecutor : public WindowExecutor {
 public:
 	WindowRowNumberExecutor(BoundWindowExpression &wexpr, ClientContext &context);
@@ -15,6 +15,7 @@
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/main/profiling_info.hpp"
+#include "duckdb/parallel/task.hpp"
 
 namespace duckdb {
 
@@ -111,6 +112,11 @@ struct ClientConfig {
 	//! The explain output type used when none is specified (default: PHYSICAL_ONLY)
 	ExplainOutputType explain_output_type = ExplainOutputType::PHYSICAL_ONLY;
 
+	//! The priority class with which the tasks of queries of this client are scheduled (default: NORMAL)
+	TaskPriority task_priority = TaskPriority::NORMAL;
+	//! The resource group in which the queries of this client run (empty if none)
+	string resource_group;
+
 	//! The maximum amount of pivot columns
 	idx_t pivot_limit = 100000;
 
@@ -15,9 +15,11 @@
 #include "duckdb/common/encryption_state.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
+#include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
 #include "duckdb/common/enums/set_scope.hpp"
+#include "duckdb/common/enums/temporary_file_compression.hpp"
 #include "duckdb/common/enums/window_aggregation_mode.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/set.hpp"
@@ -124,8 +126,16 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not automatic checkpoints are performed by a background thread instead of the committing thread
+	bool background_checkpoint = false;
+	//! Whether or not concurrently committing transactions share a single sync of the WAL (group commit)
+	bool wal_group_commit = false;
+	//! The maximum time (in microseconds) a group commit waits for other transactions before syncing the WAL
+	idx_t wal_group_commit_delay = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! Whether or not database files that are attached in read-only mode are memory-mapped
+	bool mmap_read_only_databases = false;
 	//! Whether extensions should be loaded on start-up
 	bool load_extensions = true;
 #ifdef DUCKDB_EXTENSION_AUTOLOAD_DEFAULT
@@ -157,6 +167,10 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! The compression that is applied to blocks that are written to the temporary directory
+	TemporaryFileCompression temp_file_compression = TemporaryFileCompression::NONE;
+	//! The memory tags for which large allocations (e.g. hash table pointer tables) are backed by huge pages
+	vector<MemoryTag> huge_page_memory_tags;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -248,6 +262,8 @@ struct DBConfigOptions {
 	idx_t allocator_bulk_deallocation_flush_threshold = 536870912ULL;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Whether worker threads are pinned to NUMA nodes and tasks are preferably run on the node that scheduled them
+	bool numa_aware_scheduling = false;
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
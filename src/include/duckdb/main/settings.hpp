@@ -81,6 +81,37 @@ struct CatalogErrorMaxSchema {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether or not automatic checkpoints are performed by a background thread instead of the committing thread";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitSetting {
+	static constexpr const char *Name = "wal_group_commit";
+	static constexpr const char *Description =
+	    "Whether or not concurrently committing transactions share a single sync of the write-ahead log";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct WALGroupCommitDelaySetting {
+	static constexpr const char *Name = "wal_group_commit_delay";
+	static constexpr const char *Description =
+	    "The maximum time (in microseconds) a group commit waits for other transactions to join before syncing the "
+	    "write-ahead log";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct CheckpointThresholdSetting {
 	static constexpr const char *Name = "checkpoint_threshold";
 	static constexpr const char *Description =
@@ -423,6 +454,25 @@ struct ExplainOutputSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TaskPrioritySetting {
+	static constexpr const char *Name = "task_priority";
+	static constexpr const char *Description =
+	    "The priority class with which the tasks of queries of this connection are scheduled (HIGH, NORMAL, LOW)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct ResourceGroupSetting {
+	static constexpr const char *Name = "resource_group";
+	static constexpr const char *Description = "The resource group in which the queries of this connection run";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ExportLargeBufferArrow {
 	static constexpr const char *Name = "arrow_large_buffer_size";
 	static constexpr const char *Description =
@@ -614,6 +664,17 @@ struct MaximumVacuumTasks {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct MmapReadOnlyDatabasesSetting {
+	static constexpr const char *Name = "mmap_read_only_databases";
+	static constexpr const char *Description =
+	    "Whether or not database files that are attached in read-only mode are memory-mapped, so that their blocks are "
+	    "read from the page cache instead of being copied into the buffer pool";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MergeJoinThreshold {
 	static constexpr const char *Name = "merge_join_threshold";
 	static constexpr const char *Description = "The number of rows we need on either table to choose a merge join";
@@ -870,6 +931,26 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct HugePageMemoryTagsSetting {
+	static constexpr const char *Name = "huge_page_memory_tags";
+	static constexpr const char *Description =
+	    "Comma-separated list of memory tags (e.g. HASH_TABLE) for which large allocations are backed by huge pages";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "The compression used for blocks that are offloaded to the temp directory (none or lz4)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
@@ -917,6 +998,16 @@ struct AllocatorBackgroundThreadsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct NumaAwareSchedulingSetting {
+	static constexpr const char *Name = "numa_aware_scheduling";
+	static constexpr const char *Description =
+	    "Whether to pin worker threads to NUMA nodes and prefer running tasks on the node that scheduled them.";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DuckDBApiSetting {
 	static constexpr const char *Name = "duckdb_api";
 	static constexpr const char *Description = "DuckDB API surface";
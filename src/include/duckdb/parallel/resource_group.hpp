@@ -0,0 +1,90 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/parallel/resource_group.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/optional_idx.hpp"
+
+namespace duckdb {
+
+class ResourceGroupManager;
+
+//! A ResourceGroup bounds the resources that are used by the queries that run in it
+class ResourceGroup {
+public:
+	ResourceGroup(string name, optional_idx max_threads, optional_idx max_memory, idx_t weight);
+
+	//! The name of the resource group
+	const string name;
+	//! The maximum amount of threads that the queries of the group use together (if set)
+	const optional_idx max_threads;
+	//! The maximum amount of memory that the operators of the queries of the group reserve together (if set)
+	const optional_idx max_memory;
+	//! The weight of the group - threads are distributed over the groups with running queries by weight
+	const idx_t weight;
+
+	//! The amount of queries that are currently running in the group
+	atomic<idx_t> active_queries;
+	//! The total amount of queries that have run in the group
+	atomic<idx_t> total_queries;
+	//! The memory that is currently reserved by the operators of the queries in the group
+	atomic<idx_t> memory_reservation;
+};
+
+//! A query that is registered with a resource group - the query is unregistered when this goes out of scope
+class ResourceGroupQuery {
+public:
+	ResourceGroupQuery(ResourceGroupManager &manager, shared_ptr<ResourceGroup> group);
+	~ResourceGroupQuery();
+
+	ResourceGroup &GetGroup() {
+		return *group;
+	}
+
+private:
+	ResourceGroupManager &manager;
+	shared_ptr<ResourceGroup> group;
+};
+
+//! The ResourceGroupManager holds the named resource groups of a database instance
+class ResourceGroupManager {
+	friend class ResourceGroupQuery;
+
+public:
+	ResourceGroupManager();
+
+	//! Creates a resource group, throws if a group with the same name exists and replace is not set
+	void CreateGroup(shared_ptr<ResourceGroup> group, bool replace);
+	//! Drops a resource group - queries that are running in the group keep running with its limits
+	void DropGroup(const string &name, bool if_exists);
+	//! Returns the resource group with the given name, or nullptr if it does not exist
+	shared_ptr<ResourceGroup> GetGroup(const string &name);
+	//! Returns all resource groups
+	vector<shared_ptr<ResourceGroup>> GetGroups();
+
+	//! Registers a query that runs in the given resource group
+	unique_ptr<ResourceGroupQuery> RegisterQuery(shared_ptr<ResourceGroup> group);
+	//! Returns the maximum amount of threads a single query of the group may use, given the total amount of threads
+	idx_t GetThreadLimit(const ResourceGroup &group, idx_t total_threads);
+
+private:
+	void UnregisterQuery(ResourceGroup &group);
+
+private:
+	mutex lock;
+	//! The resource groups by name
+	case_insensitive_map_t<shared_ptr<ResourceGroup>> groups;
+	//! The sum of the weights of all groups with running queries
+	idx_t active_weight;
+};
+
+} // namespace duckdb
@@ -21,6 +21,11 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR, TASK_BLOCKED };
 
+//! The priority class of a task - tasks of a higher priority class are always executed first
+enum class TaskPriority : uint8_t { HIGH = 0, NORMAL = 1, LOW = 2 };
+
+static constexpr const idx_t TASK_PRIORITY_COUNT = 3;
+
 //! Generic parallel task
 class Task : public enable_shared_from_this<Task> {
 public:
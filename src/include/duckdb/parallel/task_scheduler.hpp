@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
@@ -17,20 +18,30 @@
 namespace duckdb {
 
 struct ConcurrentQueue;
+struct QueueConsumerToken;
 struct QueueProducerToken;
 class ClientContext;
 class DatabaseInstance;
+class NumaTopology;
+class ResourceGroupManager;
 class TaskScheduler;
 
 struct SchedulerThread;
 
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, TaskPriority priority);
 	~ProducerToken();
 
+	//! Returns the priority class with which new tasks of this producer are scheduled
+	TaskPriority GetPriority() const;
+
 	TaskScheduler &scheduler;
 	unique_ptr<QueueProducerToken> token;
 	mutex producer_lock;
+	//! The priority class of the producer
+	TaskPriority priority;
+	//! The time at which the producer was created
+	steady_clock::time_point start_time;
 };
 
 //! The TaskScheduler is responsible for managing tasks and threads
@@ -38,6 +49,10 @@ class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
 	constexpr static int64_t TASK_TIMEOUT_USECS = 5000;
 
+public:
+	//! Producers of NORMAL priority that have been running for longer than this are demoted to LOW, default 1s
+	constexpr static int64_t TASK_DEMOTION_THRESHOLD_MS = 1000;
+
 public:
 	explicit TaskScheduler(DatabaseInstance &db);
 	~TaskScheduler();
@@ -45,7 +60,7 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(ClientContext &context);
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority = TaskPriority::NORMAL);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
@@ -78,6 +93,15 @@ public:
 	void SetAllocatorFlushTreshold(idx_t threshold);
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
+	//! Sets whether or not tasks are scheduled NUMA-aware. In NUMA-aware mode worker threads are pinned to the CPUs of
+	//! a NUMA node, and tasks are preferably executed on the node on which they were scheduled. Takes effect when the
+	//! threads are relaunched.
+	void SetNumaAware(bool enable);
+
+	//! Returns the resource groups of the database instance
+	ResourceGroupManager &GetResourceGroupManager() {
+		return *resource_groups;
+	}
 
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
@@ -86,11 +110,19 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Returns the task queue of the NUMA node the calling thread is running on
+	idx_t GetCurrentNode();
+	//! Pins a freshly launched worker thread to the CPUs of the given NUMA node
+	void PinThreadToNode(SchedulerThread &thread, idx_t node);
 
 private:
 	DatabaseInstance &db;
+	//! The NUMA topology of the system
+	unique_ptr<NumaTopology> numa_topology;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! The resource groups that bound the threads used by the queries running in them
+	unique_ptr<ResourceGroupManager> resource_groups;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
@@ -101,6 +133,10 @@ private:
 	atomic<idx_t> allocator_flush_threshold;
 	//! Whether allocator background threads are enabled
 	atomic<bool> allocator_background_threads;
+	//! Whether tasks are scheduled NUMA-aware
+	atomic<bool> numa_aware;
+	//! Whether the currently running threads were pinned to NUMA nodes
+	bool threads_numa_aware;
 	//! Requested thread count (set by the 'threads' setting)
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
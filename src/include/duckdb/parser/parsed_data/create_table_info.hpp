@@ -32,6 +32,8 @@ struct CreateTableInfo : public CreateInfo {
 	vector<unique_ptr<Constraint>> constraints;
 	//! CREATE TABLE as QUERY
 	unique_ptr<SelectStatement> query;
+	//! The columns the table is physically sorted on (CLUSTER BY), if any
+	vector<string> cluster_by;
 
 public:
 	DUCKDB_API unique_ptr<CreateInfo> Copy() const override;
@@ -40,6 +42,8 @@ public:
 	DUCKDB_API static unique_ptr<CreateInfo> Deserialize(Deserializer &deserializer);
 
 	string ToString() const override;
+	//! Returns the WITH (cluster_by = ...) clause of the table, or an empty string if the table is not clustered
+	string ClusterByToSQL() const;
 };
 
 } // namespace duckdb
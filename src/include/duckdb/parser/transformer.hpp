@@ -38,6 +38,7 @@ class OnConflictInfo;
 class UpdateSetInfo;
 class MacroFunction;
 struct ParserOptions;
+struct CreateTableInfo;
 struct PivotColumn;
 struct PivotColumnEntry;
 
@@ -285,6 +286,8 @@ private:
 	string TransformCollation(optional_ptr<duckdb_libpgquery::PGCollateClause> collate);
 
 	ColumnDefinition TransformColumnDefinition(duckdb_libpgquery::PGColumnDef &cdef);
+	//! Transform the WITH (...) options of a CREATE TABLE statement
+	void TransformTableOptions(optional_ptr<duckdb_libpgquery::PGList> table_options, CreateTableInfo &info);
 	//===--------------------------------------------------------------------===//
 	// Helpers
 	//===--------------------------------------------------------------------===//
@@ -0,0 +1,67 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+//! The shared state of a dynamic filter - the operator that produces the filter tightens it while the scan runs
+struct DynamicFilterData {
+public:
+	explicit DynamicFilterData(ExpressionType comparison_type);
+
+	//! The comparison type of the filter (e.g. COMPARE_LESSTHANOREQUALTO)
+	const ExpressionType comparison_type;
+
+public:
+	//! Sets the constant of the filter - the constant is only updated if this makes the filter more selective
+	void SetValue(Value val);
+	//! Returns the current filter, or nullptr if no constant has been set (yet). This does not take a lock: the
+	//! returned filter is immutable, and remains valid for the lifetime of the filter data.
+	optional_ptr<ConstantFilter> GetFilter();
+	//! Resets the filter, so that it does not filter anything
+	void Reset();
+	//! Checks the statistics against the current filter
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats);
+
+private:
+	//! Serializes updates of the filter
+	mutex lock;
+	//! The current filter, or nullptr if no constant has been set
+	atomic<ConstantFilter *> filter;
+	//! All filters that have been published - these are kept alive, as scans can still be reading them
+	vector<unique_ptr<ConstantFilter>> published_filters;
+};
+
+//! A DynamicFilter is a constant comparison of which the constant is only known (and tightened) during execution
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter data, or nullptr if the filter is not connected to an operator (e.g. after deserialization)
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -16,6 +16,7 @@ namespace duckdb {
 
 class Serializer;
 class Deserializer;
+struct FileMemoryMapping;
 
 class Block : public FileBuffer {
 public:
@@ -26,6 +27,18 @@ public:
 	block_id_t id;
 };
 
+//! A block whose buffer points into a copy-on-write memory mapping of a database file. The block does not own its
+//! memory: its pages are released back to the mapping when the block is destroyed.
+class MappedBlock : public Block {
+public:
+	MappedBlock(Allocator &allocator, block_id_t id, shared_ptr<FileMemoryMapping> mapping, idx_t location,
+	            idx_t alloc_size);
+	~MappedBlock() override;
+
+private:
+	shared_ptr<FileMemoryMapping> mapping;
+};
+
 struct BlockPointer {
 	BlockPointer(block_id_t block_id_p, uint32_t offset_p) : block_id(block_id_p), offset(offset_p) {
 	}
@@ -22,6 +22,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A range of consecutive blocks that is read into a single buffer
+struct BlockReadRequest {
+	BlockReadRequest(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	FileBuffer &buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -58,6 +69,14 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read the content of a set of block ranges - the reads are independent and can be in flight concurrently
+	virtual void BatchReadBlocks(vector<BlockReadRequest> &requests);
+	//! Whether or not the blocks are memory-mapped, in which case they are loaded through MapBlock instead of Read
+	virtual bool IsMemoryMapped() {
+		return false;
+	}
+	//! Returns a block that points directly into the memory-mapped storage
+	virtual unique_ptr<Block> MapBlock(block_id_t block_id);
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
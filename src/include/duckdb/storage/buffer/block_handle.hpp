@@ -119,6 +119,9 @@ public:
 	bool IsUnloaded() {
 		return state == BlockState::BLOCK_UNLOADED;
 	}
+	//! Whether or not the block is loaded from a memory-mapped file. Memory-mapped blocks are charged to the buffer
+	//! pool like regular blocks, and release their pages when they are evicted.
+	bool IsMemoryMapped() const;
 
 private:
 	BufferHandle Load(unique_ptr<FileBuffer> buffer = nullptr);
@@ -143,6 +146,13 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! Whether the block is hot, i.e., it was accessed again (not by a sequential scan) while it was loaded, or it was
+	//! reloaded shortly after being evicted. Hot persistent blocks are placed in the protected eviction queue.
+	bool hot;
+	//! The eviction queue that holds the latest eviction queue node of this block
+	uint8_t eviction_queue_idx;
+	//! The eviction sequence number of the probationary queue at the time this block was last evicted from it, or 0
+	idx_t probationary_eviction_seq;
 	//! When to destroy the data buffer
 	DestroyBufferUpon destroy_buffer_upon;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
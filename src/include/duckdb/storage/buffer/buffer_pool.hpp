@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/array.hpp"
+#include "duckdb/common/enums/buffer_access_pattern.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -34,6 +35,9 @@ struct BufferEvictionNode {
 
 //! The BufferPool is in charge of handling memory management for one or more databases. It defines memory limits
 //! and implements priority eviction among all users of the pool.
+//! Persistent blocks are evicted using a 2Q-style policy: blocks enter a probationary queue when they are loaded, and
+//! only move to the protected queue once they are hot (see BlockHandle::hot). The probationary queue is evicted
+//! first, so that a single large scan cannot push frequently used blocks out of memory.
 class BufferPool {
 	friend class BlockHandle;
 	friend class BlockManager;
@@ -61,6 +65,18 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Returns the number of pins of blocks with the given tag that found the block loaded
+	idx_t GetBufferHits(MemoryTag tag) const;
+	//! Returns the number of pins of blocks with the given tag that had to load the block
+	idx_t GetBufferMisses(MemoryTag tag) const;
+
+	//! Sets the memory tags for which large allocations are backed by huge pages
+	void SetHugePageTags(const vector<MemoryTag> &tags);
+	//! Whether large allocations with the given tag are backed by huge pages
+	bool UseHugePages(MemoryTag tag) const {
+		return huge_page_tags.load() & (idx_t(1) << static_cast<uint8_t>(tag));
+	}
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -87,8 +103,15 @@ protected:
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
 	//! Gets the eviction queue for the specified type
 	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the index of the eviction queue that the block handle should be added to
+	idx_t GetEvictionQueueIndex(const BlockHandle &handle) const;
+	//! Increments the dead nodes for the queue that holds the latest node of the block handle
+	void IncrementDeadNodes(const BlockHandle &handle);
+	//! Records a pin of a loaded block handle (either a hit, or a miss that loaded the block), and determines
+	//! whether the block becomes hot. Must be called while holding the block handle's lock.
+	void RecordBlockAccess(BlockHandle &handle, BufferAccessPattern pattern, bool hit);
+	//! Records the eviction of a block from the specified queue. Must be called while holding the block handle's lock.
+	void RecordBlockEviction(EvictionQueue &queue, BlockHandle &handle);
 
 protected:
 	enum class MemoryUsageCaches {
@@ -134,6 +157,20 @@ protected:
 		void UpdateUsedMemory(MemoryTag tag, int64_t size);
 	};
 
+	struct BufferAccessStatistics {
+		//! The counters are sharded by the current cpu to avoid contention between concurrent pins
+		static constexpr idx_t SHARD_COUNT = 64;
+		using BufferAccessCounters = array<atomic<idx_t>, MEMORY_TAG_COUNT>;
+
+		array<BufferAccessCounters, SHARD_COUNT> hits;
+		array<BufferAccessCounters, SHARD_COUNT> misses;
+
+		BufferAccessStatistics();
+
+		void Increment(MemoryTag tag, bool hit);
+		static idx_t Sum(const array<BufferAccessCounters, SHARD_COUNT> &counters, MemoryTag tag);
+	};
+
 	//! The lock for changing the memory limit
 	mutex limit_lock;
 	//! The maximum amount of memory that the buffer manager can keep (in bytes)
@@ -142,14 +179,20 @@ protected:
 	atomic<idx_t> allocator_bulk_deallocation_flush_threshold;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues, one per FileBufferType, followed by the protected queue for hot persistent blocks
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The number of blocks that have been evicted from the probationary queue
+	atomic<idx_t> probationary_evictions;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! To improve performance, MemoryUsage maintains counter caches based on current cpu or thread id,
 	//! and only updates the global counter when the cache value exceeds a threshold.
 	//! Therefore, the statistics may have slight differences from the actual memory usage.
 	mutable MemoryUsage memory_usage;
+	//! Per-tag buffer hit and miss counters
+	BufferAccessStatistics access_statistics;
+	//! Bitmask of the memory tags for which large allocations are backed by huge pages
+	atomic<idx_t> huge_page_tags;
 };
 
 } // namespace duckdb
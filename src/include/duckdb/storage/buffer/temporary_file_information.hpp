@@ -9,11 +9,25 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	//! The number of pins that found the block loaded
+	idx_t buffer_hits = 0;
+	//! The number of pins that had to load the block
+	idx_t buffer_misses = 0;
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size of the slots that blocks are stored in
+	idx_t slot_size = 0;
+	//! The number of blocks that are stored in the file
+	idx_t block_count = 0;
+	//! The uncompressed size of the blocks that are stored in the file
+	idx_t uncompressed_size = 0;
+	//! The total amount of (uncompressed) bytes that have been compressed and written to the file
+	idx_t compression_input_bytes = 0;
+	//! The total time spent compressing (in nanoseconds)
+	idx_t compression_time = 0;
 };
 
 } // namespace duckdb
@@ -12,6 +12,7 @@
 #include "duckdb/storage/buffer/buffer_handle.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/enums/buffer_access_pattern.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/main/config.hpp"
@@ -38,6 +39,9 @@ public:
 	//! Reallocate an in-memory buffer that is pinned.
 	virtual void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) = 0;
 	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle) = 0;
+	//! Pin a block with an access pattern hint. Blocks that are pinned by sequential scans are kept out of the
+	//! protected eviction queue, so that large scans cannot evict frequently used blocks.
+	virtual BufferHandle Pin(shared_ptr<BlockHandle> &handle, BufferAccessPattern pattern);
 	//! Prefetch a series of blocks. Note that this is a performance suggestion.
 	virtual void Prefetch(vector<shared_ptr<BlockHandle>> &handles) = 0;
 	virtual void Unpin(shared_ptr<BlockHandle> &handle) = 0;
@@ -61,6 +65,10 @@ public:
 	virtual shared_ptr<BlockHandle> RegisterSmallMemory(const idx_t size);
 
 	virtual DUCKDB_API Allocator &GetBufferAllocator();
+	//! Returns an allocator that charges its allocations to the given memory tag
+	virtual DUCKDB_API Allocator &GetBufferAllocator(MemoryTag tag);
+	//! Advise to back a large allocation of the given tag with huge pages (if enabled for the tag)
+	virtual void AdviseHugePages(MemoryTag tag, data_ptr_t pointer, idx_t size);
 	virtual DUCKDB_API void ReserveMemory(idx_t size);
 	virtual DUCKDB_API void FreeReservedMemory(idx_t size);
 	virtual vector<MemoryInformation> GetMemoryUsageInfo() const = 0;
@@ -27,7 +27,7 @@ template <class T>
 void AlpFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
 	using EXACT_TYPE = typename FloatingToExact<T>::TYPE;
 
-	AlpScanState<T> scan_state(segment);
+	AlpScanState<T> scan_state(segment, BufferAccessPattern::RANDOM);
 	scan_state.Skip(segment, UnsafeNumericCast<idx_t>(row_id));
 	auto result_data = FlatVector::GetData<EXACT_TYPE>(result);
 	result_data[result_idx] = (EXACT_TYPE)0;
@@ -72,10 +72,11 @@ struct AlpRDScanState : public SegmentScanState {
 public:
 	using EXACT_TYPE = typename FloatingToExact<T>::TYPE;
 
-	explicit AlpRDScanState(ColumnSegment &segment) : segment(segment), count(segment.count) {
+	explicit AlpRDScanState(ColumnSegment &segment, BufferAccessPattern pattern = BufferAccessPattern::SEQUENTIAL)
+	    : segment(segment), count(segment.count) {
 		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
 
-		handle = buffer_manager.Pin(segment.block);
+		handle = buffer_manager.Pin(segment.block, pattern);
 		// ScanStates never exceed the boundaries of a Segment,
 		// but are not guaranteed to start at the beginning of the Block
 		segment_data = handle.Ptr() + segment.GetBlockOffset();
@@ -28,7 +28,7 @@ template <class T>
 void ChimpFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
 	using INTERNAL_TYPE = typename ChimpType<T>::TYPE;
 
-	ChimpScanState<T> scan_state(segment);
+	ChimpScanState<T> scan_state(segment, BufferAccessPattern::RANDOM);
 	scan_state.Skip(segment, UnsafeNumericCast<idx_t>(row_id));
 	auto result_data = FlatVector::GetData<INTERNAL_TYPE>(result);
 
@@ -25,6 +25,8 @@ struct MetadataHandle;
 struct StorageManagerOptions {
 	bool read_only = false;
 	bool use_direct_io = false;
+	//! Whether or not to memory-map the database file when it is opened in read-only mode
+	bool use_mmap = false;
 	DebugInitialize debug_initialize = DebugInitialize::NO_INITIALIZE;
 	optional_idx block_alloc_size = optional_idx();
 };
@@ -67,6 +69,14 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Read the content of a set of block ranges, issuing all reads at once
+	void BatchReadBlocks(vector<BlockReadRequest> &requests) override;
+	//! Whether or not the database file is memory-mapped
+	bool IsMemoryMapped() override {
+		return mapping != nullptr;
+	}
+	//! Returns a block that points into the memory-mapped database file
+	unique_ptr<Block> MapBlock(block_id_t block_id) override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -94,6 +104,8 @@ private:
 	void Initialize(const DatabaseHeader &header, const optional_idx block_alloc_size);
 
 	void ReadAndChecksum(FileBuffer &handle, uint64_t location) const;
+	//! Verifies the checksums of a range of blocks that have been read into the buffer
+	void VerifyBlockChecksums(FileBuffer &buffer, block_id_t start_block, idx_t block_count);
 	void ChecksumAndWrite(FileBuffer &handle, uint64_t location) const;
 
 	idx_t GetBlockLocation(block_id_t block_id);
@@ -115,6 +127,8 @@ private:
 	string path;
 	//! The file handle
 	unique_ptr<FileHandle> handle;
+	//! The memory mapping of the file (if any) - mapped blocks keep it alive, as they can outlive the block manager
+	shared_ptr<FileMemoryMapping> mapping;
 	//! The buffer used to read/write to the headers
 	FileBuffer header_buffer;
 	//! The list of free blocks that can be written to currently
@@ -68,6 +68,7 @@ public:
 	void ReAllocate(shared_ptr<BlockHandle> &handle, idx_t block_size) final;
 
 	BufferHandle Pin(shared_ptr<BlockHandle> &handle) final;
+	BufferHandle Pin(shared_ptr<BlockHandle> &handle, BufferAccessPattern pattern) final;
 	void Prefetch(vector<shared_ptr<BlockHandle>> &handles) final;
 	void Unpin(shared_ptr<BlockHandle> &handle) final;
 
@@ -89,6 +90,8 @@ public:
 	void SetTemporaryDirectory(const string &new_dir) final;
 
 	DUCKDB_API Allocator &GetBufferAllocator() final;
+	DUCKDB_API Allocator &GetBufferAllocator(MemoryTag tag) final;
+	void AdviseHugePages(MemoryTag tag, data_ptr_t pointer, idx_t size) final;
 
 	DatabaseInstance &GetDatabase() override {
 		return db;
@@ -150,8 +153,9 @@ protected:
 	//! overwrites the data within with garbage. Any readers that do not hold the pin will notice
 	void VerifyZeroReaders(shared_ptr<BlockHandle> &handle);
 
+	//! Reads the given (first block, block count) ranges of blocks at once and loads them into their block handles
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-	               block_id_t first_block, block_id_t last_block);
+	               const vector<pair<block_id_t, idx_t>> &block_ranges);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
@@ -176,8 +180,9 @@ protected:
 	TemporaryFileData temporary_directory;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
-	//! Allocator associated with the buffer manager, that passes all allocations through this buffer manager
-	Allocator buffer_allocator;
+	//! Allocators associated with the buffer manager, that pass all allocations through this buffer manager
+	//! There is one allocator per memory tag, each allocator charges its allocations to its tag
+	array<unique_ptr<Allocator>, MEMORY_TAG_COUNT> buffer_allocators;
 	//! Block manager for temp data
 	unique_ptr<BlockManager> temp_block_manager;
 	//! Temporary evicted memory data per tag
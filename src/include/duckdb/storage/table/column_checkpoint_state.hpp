@@ -23,6 +23,28 @@ class DatabaseInstance;
 class RowGroup;
 class PartialBlockManager;
 class TableDataWriter;
+struct ColumnCheckpointState;
+
+//! Segments produced while compressing a column whose block allocation has been postponed. When the columns of a
+//! table are compressed in parallel, the segments are handed to the PartialBlockManager afterwards in a fixed order,
+//! so that the resulting block layout does not depend on the order in which the tasks finish.
+struct ColumnCheckpointFlushQueue {
+	struct Entry {
+		Entry(ColumnCheckpointState &state, ColumnSegment &segment, idx_t segment_size)
+		    : state(state), segment(segment), segment_size(segment_size) {
+		}
+
+		reference<ColumnCheckpointState> state;
+		reference<ColumnSegment> segment;
+		idx_t segment_size;
+	};
+
+	vector<Entry> entries;
+
+public:
+	//! Write all queued segments to the partial block manager in the order in which they were queued
+	void Flush();
+};
 
 struct ColumnCheckpointState {
 	ColumnCheckpointState(RowGroup &row_group, ColumnData &column_data, PartialBlockManager &partial_block_manager);
@@ -33,6 +55,8 @@ struct ColumnCheckpointState {
 	ColumnSegmentTree new_tree;
 	vector<DataPointer> data_pointers;
 	unique_ptr<BaseStatistics> global_stats;
+	//! If set, flushed segments are queued here instead of being written to the partial block manager directly
+	optional_ptr<ColumnCheckpointFlushQueue> flush_queue;
 
 protected:
 	PartialBlockManager &partial_block_manager;
@@ -41,6 +65,8 @@ public:
 	virtual unique_ptr<BaseStatistics> GetStatistics();
 
 	virtual void FlushSegment(unique_ptr<ColumnSegment> segment, idx_t segment_size);
+	//! Assign the segment to a (partial) block and add its data pointer
+	void FlushSegmentInternal(ColumnSegment &segment, idx_t segment_size);
 	virtual PersistentColumnData ToPersistentData();
 
 	PartialBlockManager &GetPartialBlockManager() {
@@ -34,12 +34,18 @@ struct TableScanOptions;
 struct TransactionData;
 struct PersistentColumnData;
 
+struct ColumnCheckpointFlushQueue;
+
 struct ColumnCheckpointInfo {
-	ColumnCheckpointInfo(RowGroupWriteInfo &info, idx_t column_idx) : info(info), column_idx(column_idx) {
+	ColumnCheckpointInfo(RowGroupWriteInfo &info, idx_t column_idx,
+	                     optional_ptr<ColumnCheckpointFlushQueue> flush_queue = nullptr)
+	    : info(info), column_idx(column_idx), flush_queue(flush_queue) {
 	}
 
 	RowGroupWriteInfo &info;
 	idx_t column_idx;
+	//! If set, the segments written for this column are queued instead of being flushed directly
+	optional_ptr<ColumnCheckpointFlushQueue> flush_queue;
 
 public:
 	CompressionType GetCompressionType();
@@ -35,6 +35,7 @@ class TableStatistics;
 struct ColumnSegmentInfo;
 class Vector;
 struct ColumnCheckpointState;
+struct ColumnCheckpointFlushQueue;
 struct PersistentColumnData;
 struct PersistentRowGroupData;
 struct RowGroupPointer;
@@ -139,8 +140,16 @@ public:
 	idx_t Delete(TransactionData transaction, DataTable &table, row_t *row_ids, idx_t count);
 
 	RowGroupWriteData WriteToDisk(RowGroupWriteInfo &info);
+	//! Checkpoint a single column of the row group, this allows the columns of a row group to be written in parallel.
+	//! If a flush queue is provided the written segments are not yet assigned to blocks.
+	unique_ptr<ColumnCheckpointState> WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx,
+	                                                    optional_ptr<ColumnCheckpointFlushQueue> flush_queue = nullptr);
+	//! Gather the write data from the checkpoint states of all columns
+	RowGroupWriteData GetWriteData(vector<unique_ptr<ColumnCheckpointState>> states);
 	//! Returns the number of committed rows (count - committed deletes)
 	idx_t GetCommittedRowCount();
+	//! Returns the compression types to use for each of the columns when writing the row group
+	vector<CompressionType> GetCompressionTypes(RowGroupWriter &writer);
 	RowGroupWriteData WriteToDisk(RowGroupWriter &writer);
 	RowGroupPointer Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer, TableStatistics &global_stats);
 	bool IsPersistent() const;
@@ -34,6 +34,7 @@ struct VacuumState;
 struct CollectionCheckpointState;
 struct PersistentCollectionData;
 class CheckpointTask;
+class TaskScheduler;
 
 class RowGroupCollection {
 public:
@@ -135,6 +136,9 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Rewrites the row groups so that they are sorted on the given cluster key columns
+	void ClusterRowGroups(TaskScheduler &scheduler, vector<SegmentNode<RowGroup>> &segments,
+	                      const vector<idx_t> &cluster_columns);
 
 private:
 	//! BlockManager
@@ -152,6 +156,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! Whether or not the collection has been modified since it was last sorted on the cluster key of the table
+	atomic<bool> requires_clustering;
 };
 
 } // namespace duckdb
@@ -10,6 +10,7 @@
 
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/atomic.hpp"
+#include "duckdb/common/enums/temporary_file_compression.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/block_manager.hpp"
@@ -27,7 +28,7 @@ class TemporaryFileManager;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -38,6 +39,8 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	//! Returns the number of block indexes that are in use
+	idx_t GetUsedBlockCount();
 
 private:
 	void SetMaxIndex(idx_t blocks);
@@ -48,6 +51,8 @@ private:
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
+	//! The size on disk of each block index
+	idx_t block_size;
 };
 
 //===--------------------------------------------------------------------===//
@@ -61,6 +66,10 @@ struct TemporaryFileIndex {
 
 	idx_t file_index;
 	idx_t block_index;
+	//! The compression that was applied to the block
+	TemporaryFileCompression compression = TemporaryFileCompression::NONE;
+	//! The size of the (compressed) block in the file
+	idx_t compressed_size = 0;
 
 public:
 	bool IsValid() const;
@@ -75,7 +84,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,11 +97,16 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
-	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
+	//! Writes the buffer to the slot of the given index - if the block was compressed the compressed data is written
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer,
+	                        idx_t compression_time);
+	unique_ptr<FileBuffer> ReadTemporaryBuffer(TemporaryFileIndex index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -105,8 +119,14 @@ private:
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
 	string path;
+	//! The size of the slots in this file - every block in the file is stored in a slot of this size
+	idx_t slot_size;
 	mutex file_lock;
 	BlockIndexManager index_manager;
+	//! The total amount of (uncompressed) bytes that have been compressed and written to this file
+	atomic<idx_t> compression_input_bytes;
+	//! The total time spent compressing these bytes (in nanoseconds)
+	atomic<idx_t> compression_time;
 };
 
 //===--------------------------------------------------------------------===//
@@ -159,6 +179,9 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compresses the buffer if temp file compression is enabled - returns the slot size required to store the block
+	idx_t CompressBuffer(FileBuffer &buffer, TemporaryFileIndex &index, AllocatedData &compressed_buffer,
+	                     idx_t &compression_time);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
 	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
@@ -16,6 +16,7 @@
 namespace duckdb {
 
 class ClientContext;
+class ResourceGroup;
 class TemporaryMemoryManager;
 
 //! State of the temporary memory to be managed concurrently with other states
@@ -63,6 +64,8 @@ private:
 	atomic<idx_t> reservation;
 	//! The weight used for determining the reservation for this state
 	atomic<idx_t> materialization_penalty;
+	//! The resource group of the query that this state belongs to (if any)
+	shared_ptr<ResourceGroup> resource_group;
 };
 
 //! TemporaryMemoryManager is a one-of class owned by the buffer pool that tries to dynamically assign memory
@@ -110,6 +113,8 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Computes optimal reservation of a TemporaryMemoryState based on a cost function
 	idx_t ComputeReservation(const TemporaryMemoryState &temporary_memory_state) const;
+	//! Computes the maximum reservation of a TemporaryMemoryState allowed by the memory limit of its resource group
+	static idx_t ComputeResourceGroupBound(const TemporaryMemoryState &temporary_memory_state);
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
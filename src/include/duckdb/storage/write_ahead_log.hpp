@@ -14,12 +14,15 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -112,7 +115,18 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and sync the WAL to disk
 	void Flush();
+	//! Write a flush marker and hand the WAL contents to the OS without syncing them to disk (group commit). Returns
+	//! the offset up to which the WAL has to be synced - see WaitForSync - for the flushed changes to be durable.
+	idx_t FlushWithoutSync();
+	//! Returns the offset up to which the WAL has to be synced for all flushed changes to be durable, or an invalid
+	//! index if all flushed changes have already been synced
+	optional_idx GetPendingSyncOffset();
+	//! Wait until the WAL has been synced up to (at least) the given offset. The first waiting thread syncs the WAL on
+	//! behalf of every thread that flushed before the sync started, after waiting "max_delay" microseconds for more
+	//! commits to join the group.
+	void WaitForSync(idx_t offset, idx_t max_delay);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +137,17 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+	//! The offset up to which the WAL has been handed to the OS by FlushWithoutSync
+	atomic<idx_t> flushed_offset;
+	//! Group commit state - protects the fields below
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! The offset up to which the WAL is known to be synced to disk
+	idx_t synced_offset;
+	//! Whether or not a thread is currently syncing the WAL on behalf of the group
+	bool sync_in_progress;
+	//! If a group sync failed, the error - every subsequent waiter fails with the same error
+	string sync_error;
 };
 
 } // namespace duckdb
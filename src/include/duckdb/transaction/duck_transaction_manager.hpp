@@ -11,9 +11,31 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/common/types/timestamp.hpp"
 
 namespace duckdb {
+class BackgroundCheckpointer;
 class DuckTransaction;
+struct CheckpointOptions;
+
+//! Information about a checkpoint that was performed by the transaction manager
+struct CheckpointHistoryEntry {
+	//! What caused the checkpoint to be performed
+	CheckpointTrigger trigger;
+	//! The type of checkpoint
+	CheckpointType type;
+	//! The time at which the checkpoint was started
+	timestamp_t start_time;
+	//! The size of the WAL when the checkpoint was started
+	idx_t wal_size;
+	//! The time (in seconds) the checkpoint took
+	double duration;
+	//! The time (in seconds) the checkpoint lock was held exclusively - write transactions cannot commit during this time
+	double commit_stall;
+	//! The error message, if the checkpoint failed
+	string error;
+};
 
 //! The Transaction Manager is responsible for creating and managing
 //! transactions
@@ -58,6 +80,14 @@ public:
 	void PushCatalogEntry(Transaction &transaction_p, CatalogEntry &entry, data_ptr_t extra_data = nullptr,
 	                      idx_t extra_data_size = 0);
 
+	//! Returns the most recently performed checkpoints
+	vector<CheckpointHistoryEntry> GetCheckpointHistory();
+	//! Try to perform a checkpoint requested from the background checkpointer - returns false if the checkpoint lock
+	//! could not be obtained and the checkpoint should be retried later
+	bool TryBackgroundCheckpoint();
+	//! Stop the background checkpointer (if any) - called when the database is closed
+	void StopBackgroundCheckpointer();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -67,6 +97,8 @@ protected:
 		bool can_checkpoint;
 		string reason;
 		CheckpointType type;
+		//! Whether or not the checkpoint should be performed by the background checkpointer instead
+		bool background_checkpoint = false;
 	};
 
 private:
@@ -80,6 +112,16 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Perform a checkpoint while holding the exclusive checkpoint lock, and record it in the checkpoint history. The
+	//! lock timer is started when the exclusive checkpoint lock is obtained.
+	void PerformCheckpoint(CheckpointOptions options, CheckpointTrigger trigger, Profiler &lock_timer);
+	//! Add an entry to the checkpoint history
+	void AddCheckpointHistory(CheckpointHistoryEntry entry);
+	//! Hand a checkpoint off to the background checkpointer
+	void RequestBackgroundCheckpoint();
+	//! Group commit: wait until the WAL entries of a committed transaction are synced, releasing the WAL and
+	//! transaction locks while waiting
+	ErrorData WaitForWALSync(unique_lock<mutex> &tlock, unique_ptr<lock_guard<mutex>> &held_wal_lock);
 
 private:
 	//! The current start timestamp used by transactions
@@ -110,6 +152,15 @@ private:
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
 
+	//! The background checkpointer - created when the first background checkpoint is requested
+	unique_ptr<BackgroundCheckpointer> background_checkpointer;
+	//! Whether or not the background checkpointer has been stopped
+	bool background_checkpointer_stopped = false;
+	mutex background_checkpointer_lock;
+	//! The most recently performed checkpoints
+	vector<CheckpointHistoryEntry> checkpoint_history;
+	mutex checkpoint_history_lock;
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
@@ -220,6 +220,11 @@ void AttachedDatabase::Close() {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// stop any background checkpoints before the database is closed
+		DuckTransactionManager::Get(*this).StopBackgroundCheckpointer();
+	}
+
 	if (Exception::UncaughtException()) {
 		return;
 	}
@@ -439,6 +439,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		                                                 config.options.buffer_manager_track_eviction_timestamps,
 		                                                 config.options.allocator_bulk_deallocation_flush_threshold);
 	}
+	config.buffer_pool->SetHugePageTags(config.options.huge_page_memory_tags);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
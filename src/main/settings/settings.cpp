@@ -10,6 +10,7 @@
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
@@ -95,6 +96,54 @@ Value CatalogErrorMaxSchema::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.catalog_error_max_schemas);
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = BooleanValue::Get(input);
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit
+//===--------------------------------------------------------------------===//
+void WALGroupCommitSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit = BooleanValue::Get(input);
+}
+
+void WALGroupCommitSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit = DBConfig().options.wal_group_commit;
+}
+
+Value WALGroupCommitSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.wal_group_commit);
+}
+
+//===--------------------------------------------------------------------===//
+// WAL Group Commit Delay
+//===--------------------------------------------------------------------===//
+void WALGroupCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_group_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALGroupCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_group_commit_delay = DBConfig().options.wal_group_commit_delay;
+}
+
+Value WALGroupCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_group_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -972,6 +1021,58 @@ Value ExplainOutputSetting::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Task Priority
+//===--------------------------------------------------------------------===//
+void TaskPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).task_priority = ClientConfig().task_priority;
+}
+
+void TaskPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "high") {
+		ClientConfig::GetConfig(context).task_priority = TaskPriority::HIGH;
+	} else if (parameter == "normal") {
+		ClientConfig::GetConfig(context).task_priority = TaskPriority::NORMAL;
+	} else if (parameter == "low") {
+		ClientConfig::GetConfig(context).task_priority = TaskPriority::LOW;
+	} else {
+		throw ParserException("Unrecognized task priority \"%s\", expected either HIGH, NORMAL or LOW", parameter);
+	}
+}
+
+Value TaskPrioritySetting::GetSetting(const ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).task_priority) {
+	case TaskPriority::HIGH:
+		return "high";
+	case TaskPriority::NORMAL:
+		return "normal";
+	case TaskPriority::LOW:
+		return "low";
+	default:
+		throw InternalException("Unrecognized task priority");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Resource Group
+//===--------------------------------------------------------------------===//
+void ResourceGroupSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).resource_group = ClientConfig().resource_group;
+}
+
+void ResourceGroupSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = input.ToString();
+	if (!parameter.empty() && !TaskScheduler::GetScheduler(context).GetResourceGroupManager().GetGroup(parameter)) {
+		throw InvalidInputException("Resource group \"%s\" does not exist", parameter);
+	}
+	ClientConfig::GetConfig(context).resource_group = parameter;
+}
+
+Value ResourceGroupSetting::GetSetting(const ClientContext &context) {
+	return Value(ClientConfig::GetConfig(context).resource_group);
+}
+
 //===--------------------------------------------------------------------===//
 // Extension Directory Setting
 //===--------------------------------------------------------------------===//
@@ -1360,6 +1461,22 @@ Value MaximumVacuumTasks::GetSetting(const ClientContext &context) {
 	return Value::UBIGINT(config.options.max_vacuum_tasks);
 }
 
+//===--------------------------------------------------------------------===//
+// Mmap Read Only Databases
+//===--------------------------------------------------------------------===//
+void MmapReadOnlyDatabasesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.mmap_read_only_databases = BooleanValue::Get(input);
+}
+
+void MmapReadOnlyDatabasesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.mmap_read_only_databases = DBConfig().options.mmap_read_only_databases;
+}
+
+Value MmapReadOnlyDatabasesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.mmap_read_only_databases);
+}
+
 //===--------------------------------------------------------------------===//
 // Merge Join Threshold
 //===--------------------------------------------------------------------===//
@@ -1862,6 +1979,80 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "none" || parameter == "uncompressed") {
+		config.options.temp_file_compression = TemporaryFileCompression::NONE;
+	} else if (parameter == "lz4") {
+		config.options.temp_file_compression = TemporaryFileCompression::LZ4;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option TEMP_FILE_COMPRESSION \"%s\". Expected NONE or LZ4.", parameter);
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.temp_file_compression) {
+	case TemporaryFileCompression::NONE:
+		return "none";
+	case TemporaryFileCompression::LZ4:
+		return "lz4";
+	default:
+		throw InternalException("Unknown temp file compression setting");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Huge Page Memory Tags
+//===--------------------------------------------------------------------===//
+void HugePageMemoryTagsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	vector<MemoryTag> tags;
+	for (auto &entry : StringUtil::Split(input.ToString(), ',')) {
+		auto tag_name = StringUtil::Upper(entry);
+		StringUtil::Trim(tag_name);
+		if (tag_name.empty()) {
+			continue;
+		}
+		MemoryTag tag;
+		try {
+			tag = EnumUtil::FromString<MemoryTag>(tag_name);
+		} catch (std::exception &ex) {
+			throw InvalidInputException("Unrecognized memory tag \"%s\" for option huge_page_memory_tags", tag_name);
+		}
+		if (std::find(tags.begin(), tags.end(), tag) == tags.end()) {
+			tags.push_back(tag);
+		}
+	}
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetHugePageTags(tags);
+	}
+	config.options.huge_page_memory_tags = std::move(tags);
+}
+
+void HugePageMemoryTagsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.huge_page_memory_tags = DBConfig().options.huge_page_memory_tags;
+	if (db) {
+		BufferManager::GetBufferManager(*db).GetBufferPool().SetHugePageTags(config.options.huge_page_memory_tags);
+	}
+}
+
+Value HugePageMemoryTagsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	vector<string> tag_names;
+	for (auto &tag : config.options.huge_page_memory_tags) {
+		tag_names.push_back(EnumUtil::ToString(tag));
+	}
+	return Value(StringUtil::Join(tag_names, ","));
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -1974,6 +2165,28 @@ Value AllocatorBackgroundThreadsSetting::GetSetting(const ClientContext &context
 	return Value(config.options.allocator_background_threads);
 }
 
+//===--------------------------------------------------------------------===//
+// NUMA Aware Scheduling
+//===--------------------------------------------------------------------===//
+void NumaAwareSchedulingSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.numa_aware_scheduling = input.GetValue<bool>();
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetNumaAware(config.options.numa_aware_scheduling);
+	}
+}
+
+void NumaAwareSchedulingSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.numa_aware_scheduling = DBConfig().options.numa_aware_scheduling;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetNumaAware(config.options.numa_aware_scheduling);
+	}
+}
+
+Value NumaAwareSchedulingSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.numa_aware_scheduling);
+}
+
 //===--------------------------------------------------------------------===//
 // DuckDBApi Setting
 //===--------------------------------------------------------------------===//
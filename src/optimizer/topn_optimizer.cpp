@@ -1,8 +1,12 @@
 #include "duckdb/optimizer/topn_optimizer.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 #include "duckdb/planner/operator/logical_order.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
@@ -32,6 +36,91 @@ bool TopN::CanOptimize(LogicalOperator &op) {
 	return false;
 }
 
+static bool CanPushdownDynamicFilter(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void TopN::PushdownDynamicFilters(LogicalTopN &op) {
+	// the heap of the top-n has a boundary value: rows for which the first order sorts after it can be discarded
+	// we push a filter on the first order into the scan, of which the constant is set to the boundary during execution
+	auto &order = op.orders[0];
+	if (order.expression->type != ExpressionType::BOUND_COLUMN_REF) {
+		return;
+	}
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values sort before the boundary value, but a comparison filter would remove them
+		return;
+	}
+	auto &type = order.expression->return_type;
+	if (!CanPushdownDynamicFilter(type)) {
+		return;
+	}
+	// follow the column through projections and filters until we find the scan that produces it
+	auto binding = order.expression->Cast<BoundColumnRefExpression>().binding;
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		auto &current = child.get();
+		switch (current.type) {
+		case LogicalOperatorType::LOGICAL_PROJECTION: {
+			auto &proj = current.Cast<LogicalProjection>();
+			if (binding.table_index != proj.table_index) {
+				return;
+			}
+			auto &expr = proj.expressions[binding.column_index];
+			if (expr->type != ExpressionType::BOUND_COLUMN_REF) {
+				return;
+			}
+			binding = expr->Cast<BoundColumnRefExpression>().binding;
+			break;
+		}
+		case LogicalOperatorType::LOGICAL_FILTER:
+			// filters do not change the bindings of their child
+			break;
+		default:
+			return;
+		}
+		child = *current.children[0];
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.function.filter_pushdown || !get.children.empty() || binding.table_index != get.table_index) {
+		return;
+	}
+	if (get.function.supports_pushdown_type && !get.function.supports_pushdown_type(type)) {
+		return;
+	}
+	auto &column_ids = get.GetColumnIds();
+	if (binding.column_index >= column_ids.size() || IsRowIdColumnId(column_ids[binding.column_index])) {
+		return;
+	}
+	// rows that are equal to the boundary are kept, so that ties on the next orders are still resolved correctly
+	auto comparison_type = order.type == OrderType::ASCENDING ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+	                                                          : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	op.dynamic_filter = make_shared_ptr<DynamicFilterData>(comparison_type);
+	get.table_filters.PushFilter(column_ids[binding.column_index], make_uniq<DynamicFilter>(op.dynamic_filter));
+}
+
 unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 	if (CanOptimize(*op)) {
 
@@ -67,6 +156,7 @@ unique_ptr<LogicalOperator> TopN::Optimize(unique_ptr<LogicalOperator> op) {
 			cardinality = topn->children[0]->estimated_cardinality;
 		}
 		topn->SetEstimatedCardinality(cardinality);
+		PushdownDynamicFilters(*topn);
 		op = std::move(topn);
 
 		// reconstruct all projection nodes above limit operator
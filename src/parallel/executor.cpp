@@ -15,6 +15,7 @@
 #include "duckdb/parallel/pipeline_finish_event.hpp"
 #include "duckdb/parallel/pipeline_initialize_event.hpp"
 #include "duckdb/parallel/pipeline_prepare_finish_event.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 
@@ -387,13 +388,24 @@ void Executor::Initialize(PhysicalOperator &plan) {
 void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto &client_config = ClientConfig::GetConfig(context);
+	resource_group_query.reset();
+	if (!client_config.resource_group.empty()) {
+		// register the query with the resource group of the connection
+		auto &resource_groups = scheduler.GetResourceGroupManager();
+		auto group = resource_groups.GetGroup(client_config.resource_group);
+		if (!group) {
+			throw CatalogException("Resource group \"%s\" does not exist", client_config.resource_group);
+		}
+		resource_group_query = resource_groups.RegisterQuery(std::move(group));
+	}
 	{
 		lock_guard<mutex> elock(executor_lock);
 		physical_plan = &plan;
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(client_config.task_priority);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
@@ -612,6 +624,15 @@ PendingExecutionResult Executor::ExecuteTask(bool dry_run) {
 	return execution_result;
 }
 
+idx_t Executor::GetThreadLimit() {
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	if (!resource_group_query) {
+		return thread_count;
+	}
+	return scheduler.GetResourceGroupManager().GetThreadLimit(resource_group_query->GetGroup(), thread_count);
+}
+
 void Executor::Reset() {
 	lock_guard<mutex> elock(executor_lock);
 	physical_plan = nullptr;
@@ -0,0 +1,101 @@
+#include "duckdb/parallel/resource_group.hpp"
+
+#include "duckdb/common/exception/catalog_exception.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+ResourceGroup::ResourceGroup(string name_p, optional_idx max_threads_p, optional_idx max_memory_p, idx_t weight_p)
+    : name(std::move(name_p)), max_threads(max_threads_p), max_memory(max_memory_p), weight(weight_p),
+      active_queries(0), total_queries(0), memory_reservation(0) {
+	D_ASSERT(weight > 0);
+}
+
+ResourceGroupQuery::ResourceGroupQuery(ResourceGroupManager &manager_p, shared_ptr<ResourceGroup> group_p)
+    : manager(manager_p), group(std::move(group_p)) {
+}
+
+ResourceGroupQuery::~ResourceGroupQuery() {
+	manager.UnregisterQuery(*group);
+}
+
+ResourceGroupManager::ResourceGroupManager() : active_weight(0) {
+}
+
+void ResourceGroupManager::CreateGroup(shared_ptr<ResourceGroup> group, bool replace) {
+	lock_guard<mutex> guard(lock);
+	auto entry = groups.find(group->name);
+	if (entry != groups.end() && !replace) {
+		throw CatalogException("Resource group \"%s\" already exists", group->name);
+	}
+	groups[group->name] = std::move(group);
+}
+
+void ResourceGroupManager::DropGroup(const string &name, bool if_exists) {
+	lock_guard<mutex> guard(lock);
+	auto entry = groups.find(name);
+	if (entry == groups.end()) {
+		if (if_exists) {
+			return;
+		}
+		throw CatalogException("Resource group \"%s\" does not exist", name);
+	}
+	groups.erase(entry);
+}
+
+shared_ptr<ResourceGroup> ResourceGroupManager::GetGroup(const string &name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = groups.find(name);
+	if (entry == groups.end()) {
+		return nullptr;
+	}
+	return entry->second;
+}
+
+vector<shared_ptr<ResourceGroup>> ResourceGroupManager::GetGroups() {
+	lock_guard<mutex> guard(lock);
+	vector<shared_ptr<ResourceGroup>> result;
+	for (auto &entry : groups) {
+		result.push_back(entry.second);
+	}
+	std::sort(result.begin(), result.end(),
+	          [](const shared_ptr<ResourceGroup> &a, const shared_ptr<ResourceGroup> &b) { return a->name < b->name; });
+	return result;
+}
+
+unique_ptr<ResourceGroupQuery> ResourceGroupManager::RegisterQuery(shared_ptr<ResourceGroup> group) {
+	lock_guard<mutex> guard(lock);
+	if (group->active_queries++ == 0) {
+		// the group becomes active: it now takes part in the distribution of the threads
+		active_weight += group->weight;
+	}
+	group->total_queries++;
+	return make_uniq<ResourceGroupQuery>(*this, std::move(group));
+}
+
+void ResourceGroupManager::UnregisterQuery(ResourceGroup &group) {
+	lock_guard<mutex> guard(lock);
+	D_ASSERT(group.active_queries > 0);
+	if (--group.active_queries == 0) {
+		D_ASSERT(active_weight >= group.weight);
+		active_weight -= group.weight;
+	}
+}
+
+idx_t ResourceGroupManager::GetThreadLimit(const ResourceGroup &group, idx_t total_threads) {
+	lock_guard<mutex> guard(lock);
+	auto group_threads = total_threads;
+	if (active_weight > group.weight) {
+		// other groups are running queries as well: the group gets its weighted share of the threads
+		group_threads = total_threads * group.weight / active_weight;
+	}
+	if (group.max_threads.IsValid()) {
+		group_threads = MinValue(group_threads, group.max_threads.GetIndex());
+	}
+	// the threads of the group are divided over its running queries
+	auto query_count = MaxValue<idx_t>(group.active_queries, 1);
+	return MaxValue<idx_t>(group_threads / query_count, 1);
+}
+
+} // namespace duckdb
@@ -2,9 +2,11 @@
 
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/numa_topology.hpp"
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
@@ -23,6 +25,10 @@
 #include <unistd.h>
 #endif
 
+#if defined(__linux__) && !defined(DUCKDB_WASM) && !defined(DUCKDB_NO_THREADS)
+#include <pthread.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -38,24 +44,60 @@ struct SchedulerThread {
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
+//! The ConcurrentQueue holds one task queue per priority class and NUMA node. Tasks are enqueued on the queue of their
+//! priority class and of the node of the scheduling thread. Threads dequeue from the highest priority class that has
+//! tasks available, preferring the queue of their own node and stealing from the other nodes otherwise.
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	explicit ConcurrentQueue(idx_t node_count);
+
+	idx_t node_count;
+	vector<unique_ptr<concurrent_queue_t>> q;
 	lightweight_semaphore_t semaphore;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	idx_t GetQueueIndex(TaskPriority priority, idx_t node) const {
+		return static_cast<idx_t>(priority) * node_count + node;
+	}
+
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, TaskPriority priority, idx_t node);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
+	bool Dequeue(shared_ptr<Task> &task, idx_t node, optional_ptr<QueueConsumerToken> consumer = nullptr);
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	explicit QueueProducerToken(ConcurrentQueue &queue) {
+		for (auto &task_queue : queue.q) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ProducerToken>(*task_queue));
+		}
+	}
+
+	//! One producer token per task queue
+	vector<unique_ptr<duckdb_moodycamel::ProducerToken>> queue_tokens;
+};
+
+//! The QueueConsumerToken is held by a worker thread. Dequeueing through a consumer token makes the thread keep
+//! taking tasks from the same producer (i.e. the same query) for a while before rotating to the next producer,
+//! instead of interleaving tasks of all running queries.
+struct QueueConsumerToken {
+	explicit QueueConsumerToken(ConcurrentQueue &queue) {
+		for (auto &task_queue : queue.q) {
+			queue_tokens.push_back(make_uniq<duckdb_moodycamel::ConsumerToken>(*task_queue));
+		}
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
+	//! One consumer token per task queue
+	vector<unique_ptr<duckdb_moodycamel::ConsumerToken>> queue_tokens;
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+ConcurrentQueue::ConcurrentQueue(idx_t node_count_p) : node_count(node_count_p) {
+	for (idx_t i = 0; i < TASK_PRIORITY_COUNT * node_count; i++) {
+		q.push_back(make_uniq<concurrent_queue_t>());
+	}
+}
+
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, TaskPriority priority, idx_t node) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	auto queue_idx = GetQueueIndex(priority, node);
+	if (q[queue_idx]->enqueue(*token.token->queue_tokens[queue_idx], std::move(task))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -64,19 +106,41 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	for (idx_t queue_idx = 0; queue_idx < q.size(); queue_idx++) {
+		if (q[queue_idx]->try_dequeue_from_producer(*token.token->queue_tokens[queue_idx], task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ConcurrentQueue::Dequeue(shared_ptr<Task> &task, idx_t node, optional_ptr<QueueConsumerToken> consumer) {
+	for (idx_t priority = 0; priority < TASK_PRIORITY_COUNT; priority++) {
+		for (idx_t i = 0; i < node_count; i++) {
+			auto queue_idx = GetQueueIndex(static_cast<TaskPriority>(priority), (node + i) % node_count);
+			auto &task_queue = *q[queue_idx];
+			if (consumer ? task_queue.try_dequeue(*consumer->queue_tokens[queue_idx], task)
+			             : task_queue.try_dequeue(task)) {
+				return true;
+			}
+		}
+	}
+	return false;
 }
 
 #else
 struct ConcurrentQueue {
+	explicit ConcurrentQueue(idx_t node_count) {
+	}
+
 	reference_map_t<QueueProducerToken, std::queue<shared_ptr<Task>>> q;
 	mutex qlock;
 
-	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
+	void Enqueue(ProducerToken &token, shared_ptr<Task> task, TaskPriority priority, idx_t node);
 	bool DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
+void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task, TaskPriority priority, idx_t node) {
 	lock_guard<mutex> lock(qlock);
 	q[std::ref(*token.token)].push(std::move(task));
 }
@@ -110,17 +174,32 @@ private:
 };
 #endif
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(std::move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token, TaskPriority priority)
+    : scheduler(scheduler), token(std::move(token)), priority(priority), start_time(steady_clock::now()) {
+}
+
+TaskPriority ProducerToken::GetPriority() const {
+	if (priority != TaskPriority::NORMAL) {
+		return priority;
+	}
+	// producers of normal priority that have been running for a long time are demoted, so that long-running queries
+	// cannot starve short interactive queries
+	auto elapsed = duration_cast<milliseconds>(steady_clock::now() - start_time).count();
+	if (elapsed >= TaskScheduler::TASK_DEMOTION_THRESHOLD_MS) {
+		return TaskPriority::LOW;
+	}
+	return TaskPriority::NORMAL;
 }
 
 ProducerToken::~ProducerToken() {
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), numa_topology(make_uniq<NumaTopology>(NumaTopology::Detect(*db.config.file_system))),
+      queue(make_uniq<ConcurrentQueue>(numa_topology->NodeCount())), resource_groups(make_uniq<ResourceGroupManager>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
-      allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
+      allocator_background_threads(db.config.options.allocator_background_threads),
+      numa_aware(db.config.options.numa_aware_scheduling), threads_numa_aware(false), requested_thread_count(0),
       current_thread_count(1) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
@@ -143,14 +222,14 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 	return db.GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority) {
 	auto token = make_uniq<QueueProducerToken>(*queue);
-	return make_uniq<ProducerToken>(*this, std::move(token));
+	return make_uniq<ProducerToken>(*this, std::move(token), priority);
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queue->Enqueue(token, std::move(task), token.GetPriority(), GetCurrentNode());
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
@@ -162,6 +241,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 	static constexpr const int64_t INITIAL_FLUSH_WAIT = 500000; // initial wait time of 0.5s (in mus) before flushing
 
 	shared_ptr<Task> task;
+	QueueConsumerToken consumer(*queue);
 	// loop until the marker is set to false
 	while (*marker) {
 		if (!Allocator::SupportsFlush()) {
@@ -185,7 +265,7 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				}
 			}
 		}
-		if (queue->q.try_dequeue(task)) {
+		if (queue->Dequeue(task, GetCurrentNode(), consumer)) {
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 			switch (execute_result) {
@@ -218,7 +298,7 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 	// loop until the marker is set to false
 	while (*marker && completed_tasks < max_tasks) {
 		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task, GetCurrentNode())) {
 			return completed_tasks;
 		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
@@ -248,7 +328,7 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 	shared_ptr<Task> task;
 	for (idx_t i = 0; i < max_tasks; i++) {
 		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		if (!queue->Dequeue(task, GetCurrentNode())) {
 			return;
 		}
 		try {
@@ -274,6 +354,13 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #endif
 }
 
+idx_t TaskScheduler::GetCurrentNode() {
+	if (!numa_aware || numa_topology->NodeCount() == 1) {
+		return 0;
+	}
+	return numa_topology->GetNodeOfCPU(GetEstimatedCPUId());
+}
+
 #ifndef DUCKDB_NO_THREADS
 static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
 	scheduler->ExecuteForever(marker);
@@ -310,6 +397,10 @@ void TaskScheduler::SetAllocatorBackgroundThreads(bool enable) {
 	Allocator::SetBackgroundThreads(enable);
 }
 
+void TaskScheduler::SetNumaAware(bool enable) {
+	numa_aware = enable;
+}
+
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
@@ -357,16 +448,36 @@ void TaskScheduler::RelaunchThreads() {
 	RelaunchThreadsInternal(n);
 }
 
+void TaskScheduler::PinThreadToNode(SchedulerThread &thread, idx_t node) {
+#if defined(__linux__) && !defined(DUCKDB_WASM) && !defined(DUCKDB_NO_THREADS)
+	auto &node_cpus = numa_topology->GetNodeCPUs(node);
+	if (node_cpus.empty()) {
+		return;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	for (auto &cpu : node_cpus) {
+		if (cpu < CPU_SETSIZE) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	}
+	// pinning is best-effort: if it fails (e.g. because of a restricted cpuset) the thread keeps running unpinned
+	pthread_setaffinity_np(thread.internal_thread->native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
-	if (threads.size() == new_thread_count) {
+	// threads are only pinned if there are multiple NUMA nodes
+	bool pin_threads = numa_aware && numa_topology->NodeCount() > 1;
+	if (threads.size() == new_thread_count && threads_numa_aware == pin_threads) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
-		// we are reducing the number of threads: clear all threads first
+	if (threads.size() > new_thread_count || threads_numa_aware != pin_threads) {
+		// we are reducing the number of threads or changing how they are pinned: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
@@ -394,11 +505,16 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 				break;
 			}
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
+			if (pin_threads) {
+				// distribute the threads round-robin over the NUMA nodes
+				PinThreadToNode(*thread_wrapper, threads.size() % numa_topology->NodeCount());
+			}
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
 	}
+	threads_numa_aware = pin_threads;
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 	if (Allocator::SupportsFlush()) {
 		Allocator::FlushAll();
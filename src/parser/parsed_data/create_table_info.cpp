@@ -2,6 +2,7 @@
 #include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
 
 namespace duckdb {
 
@@ -26,9 +27,21 @@ unique_ptr<CreateInfo> CreateTableInfo::Copy() const {
 	if (query) {
 		result->query = unique_ptr_cast<SQLStatement, SelectStatement>(query->Copy());
 	}
+	result->cluster_by = cluster_by;
 	return std::move(result);
 }
 
+string CreateTableInfo::ClusterByToSQL() const {
+	if (cluster_by.empty()) {
+		return string();
+	}
+	vector<string> quoted_columns;
+	for (auto &column : cluster_by) {
+		quoted_columns.push_back(KeywordHelper::WriteOptionallyQuoted(column));
+	}
+	return " WITH (cluster_by = " + KeywordHelper::WriteQuoted(StringUtil::Join(quoted_columns, ", ")) + ")";
+}
+
 string CreateTableInfo::ToString() const {
 	string ret = "";
 
@@ -47,9 +60,11 @@ string CreateTableInfo::ToString() const {
 	ret += QualifierToString(temporary ? "" : catalog, schema, table);
 
 	if (query != nullptr) {
+		ret += ClusterByToSQL();
 		ret += " AS " + query->ToString();
 	} else {
-		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints) + ";";
+		ret += TableCatalogEntry::ColumnsToSQL(columns, constraints);
+		ret += ClusterByToSQL() + ";";
 	}
 	return ret;
 }
@@ -66,6 +66,80 @@ ColumnDefinition Transformer::TransformColumnDefinition(duckdb_libpgquery::PGCol
 	return ColumnDefinition(colname, target_type);
 }
 
+static bool IsUnquotedIdentifierCharacter(char c) {
+	return StringUtil::CharacterIsAlpha(c) || StringUtil::CharacterIsDigit(c) || c == '_' || uint8_t(c) >= 0x80;
+}
+
+//! Split a cluster key - a comma-separated list of (optionally quoted) column names
+static vector<string> SplitClusterKey(const string &cluster_key) {
+	// the parser cannot be used here, as its state is still in use by the statement that is being transformed
+	vector<string> result;
+	idx_t pos = 0;
+	while (true) {
+		while (pos < cluster_key.size() && StringUtil::CharacterIsSpace(cluster_key[pos])) {
+			pos++;
+		}
+		string column_name;
+		bool is_quoted = pos < cluster_key.size() && cluster_key[pos] == '"';
+		if (is_quoted) {
+			// quoted identifier - a double quote inside of it is escaped by another double quote
+			for (pos++; pos < cluster_key.size(); pos++) {
+				if (cluster_key[pos] == '"') {
+					if (pos + 1 >= cluster_key.size() || cluster_key[pos + 1] != '"') {
+						break;
+					}
+					pos++;
+				}
+				column_name += cluster_key[pos];
+			}
+			if (pos >= cluster_key.size()) {
+				throw ParserException("Unterminated quoted column name in cluster key \"%s\"", cluster_key);
+			}
+			pos++;
+		} else {
+			while (pos < cluster_key.size() && IsUnquotedIdentifierCharacter(cluster_key[pos])) {
+				column_name += cluster_key[pos++];
+			}
+		}
+		while (pos < cluster_key.size() && StringUtil::CharacterIsSpace(cluster_key[pos])) {
+			pos++;
+		}
+		bool at_separator = pos >= cluster_key.size() || cluster_key[pos] == ',';
+		if ((column_name.empty() && !is_quoted) || !at_separator) {
+			throw ParserException("The cluster_by option can only contain a list of column names, found \"%s\"",
+			                      cluster_key);
+		}
+		result.push_back(std::move(column_name));
+		if (pos >= cluster_key.size()) {
+			return result;
+		}
+		// skip the comma
+		pos++;
+	}
+}
+
+void Transformer::TransformTableOptions(optional_ptr<duckdb_libpgquery::PGList> table_options, CreateTableInfo &info) {
+	if (!table_options) {
+		return;
+	}
+	duckdb_libpgquery::PGListCell *cell;
+	for_each_cell(cell, table_options->head) {
+		auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+		if (!StringUtil::CIEquals(def_elem->defname, "cluster_by")) {
+			// other table options are accepted and ignored
+			continue;
+		}
+		auto arg = PGPointerCast<duckdb_libpgquery::PGValue>(def_elem->arg);
+		if (!arg || arg->type != duckdb_libpgquery::T_PGString) {
+			throw ParserException("The cluster_by option expects a string with a list of columns, e.g. "
+			                      "WITH (cluster_by = 'col1, col2')");
+		}
+		for (auto &column_name : SplitClusterKey(arg->val.str)) {
+			info.cluster_by.push_back(std::move(column_name));
+		}
+	}
+}
+
 unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery::PGCreateStmt &stmt) {
 	auto result = make_uniq<CreateStatement>();
 	auto info = make_uniq<CreateTableInfo>();
@@ -123,6 +197,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTable(duckdb_libpgquery:
 	if (!column_count) {
 		throw ParserException("Table must have at least one column!");
 	}
+	TransformTableOptions(stmt.options, *info);
 
 	result->info = std::move(info);
 	return result;
@@ -8,9 +8,19 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquer
 	if (stmt.relkind == duckdb_libpgquery::PG_OBJECT_MATVIEW) {
 		throw NotImplementedException("Materialized view not implemented");
 	}
-	if (stmt.is_select_into || stmt.into->colNames || stmt.into->options) {
+	if (stmt.is_select_into || stmt.into->colNames) {
 		throw NotImplementedException("Unimplemented features for CREATE TABLE as");
 	}
+	if (stmt.into->options) {
+		// the cluster key is the only table option that is supported here
+		duckdb_libpgquery::PGListCell *cell;
+		for_each_cell(cell, stmt.into->options->head) {
+			auto def_elem = PGPointerCast<duckdb_libpgquery::PGDefElem>(cell->data.ptr_value);
+			if (!StringUtil::CIEquals(def_elem->defname, "cluster_by")) {
+				throw NotImplementedException("Unimplemented features for CREATE TABLE as");
+			}
+		}
+	}
 	auto qname = TransformQualifiedName(*stmt.into->rel);
 	if (stmt.query->type != duckdb_libpgquery::T_PGSelectStmt) {
 		throw ParserException("CREATE TABLE AS requires a SELECT clause");
@@ -26,6 +36,7 @@ unique_ptr<CreateStatement> Transformer::TransformCreateTableAs(duckdb_libpgquer
 	info->temporary =
 	    stmt.into->rel->relpersistence == duckdb_libpgquery::PGPostgresRelPersistence::PG_RELPERSISTENCE_TEMP;
 	info->query = std::move(query);
+	TransformTableOptions(stmt.into->options, *info);
 	result->info = std::move(info);
 	return result;
 }
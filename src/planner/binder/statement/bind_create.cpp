@@ -558,6 +558,10 @@ unique_ptr<LogicalOperator> DuckCatalog::BindCreateIndex(Binder &binder, CreateS
                                                          TableCatalogEntry &table, unique_ptr<LogicalOperator> plan) {
 	D_ASSERT(plan->type == LogicalOperatorType::LOGICAL_GET);
 	auto &base = stmt.info->Cast<CreateIndexInfo>();
+	if (!table.GetClusterBy().empty()) {
+		// re-sorting the table would invalidate the row ids stored in the index
+		throw BinderException("Cannot create an index on clustered table \"%s\"", table.name);
+	}
 
 	auto &get = plan->Cast<LogicalGet>();
 	// bind the index expressions
@@ -293,6 +293,35 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	return BindCreateTableInfo(std::move(info), schema, bound_defaults);
 }
 
+static void BindClusterBy(CreateTableInfo &info) {
+	if (info.cluster_by.empty()) {
+		return;
+	}
+	// re-sorting the table would invalidate the row ids stored in its indexes
+	for (auto &constraint : info.constraints) {
+		if (constraint->type == ConstraintType::UNIQUE || constraint->type == ConstraintType::FOREIGN_KEY) {
+			throw BinderException("Clustered table \"%s\" cannot have PRIMARY KEY, UNIQUE or FOREIGN KEY constraints",
+			                      info.table);
+		}
+	}
+	case_insensitive_set_t cluster_columns;
+	for (auto &cluster_column : info.cluster_by) {
+		if (!info.columns.ColumnExists(cluster_column)) {
+			throw BinderException("Cluster key column \"%s\" does not exist in table \"%s\"", cluster_column,
+			                      info.table);
+		}
+		auto &column = info.columns.GetColumn(cluster_column);
+		if (column.Generated()) {
+			throw BinderException("Cluster key column \"%s\" cannot be a generated column", cluster_column);
+		}
+		if (!cluster_columns.insert(column.Name()).second) {
+			throw BinderException("Cluster key column \"%s\" is specified more than once", cluster_column);
+		}
+		// store the column name as it was defined in the table
+		cluster_column = column.Name();
+	}
+}
+
 unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableCheckpoint(unique_ptr<CreateInfo> info,
                                                                    SchemaCatalogEntry &schema) {
 	auto result = make_uniq<BoundCreateTableInfo>(schema, std::move(info));
@@ -343,6 +372,7 @@ unique_ptr<BoundCreateTableInfo> Binder::BindCreateTableInfo(unique_ptr<CreateIn
 	if (base.columns.PhysicalColumnCount() == 0) {
 		throw BinderException("Creating a table without physical (non-generated) columns is not supported");
 	}
+	BindClusterBy(base);
 	// bind collations to detect any unsupported collation errors
 	for (idx_t i = 0; i < base.columns.PhysicalColumnCount(); i++) {
 		auto &column = base.columns.GetColumnMutable(PhysicalIndex(i));
@@ -0,0 +1,88 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type_p)
+    : comparison_type(comparison_type_p), filter(nullptr) {
+	D_ASSERT(comparison_type == ExpressionType::COMPARE_LESSTHAN ||
+	         comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO ||
+	         comparison_type == ExpressionType::COMPARE_GREATERTHAN ||
+	         comparison_type == ExpressionType::COMPARE_GREATERTHANOREQUALTO);
+}
+
+void DynamicFilterData::SetValue(Value val) {
+	if (val.IsNull()) {
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	auto current_filter = filter.load();
+	if (current_filter) {
+		// the filter is only ever tightened
+		auto &current = current_filter->constant;
+		bool is_upper_bound = comparison_type == ExpressionType::COMPARE_LESSTHAN ||
+		                      comparison_type == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+		if (is_upper_bound ? !(val < current) : !(val > current)) {
+			return;
+		}
+	}
+	// publish a new filter - the previous one is kept alive, as concurrent scans might still be using it
+	published_filters.push_back(make_uniq<ConstantFilter>(comparison_type, std::move(val)));
+	filter = published_filters.back().get();
+}
+
+optional_ptr<ConstantFilter> DynamicFilterData::GetFilter() {
+	return filter.load();
+}
+
+void DynamicFilterData::Reset() {
+	lock_guard<mutex> guard(lock);
+	filter = nullptr;
+}
+
+FilterPropagateResult DynamicFilterData::CheckStatistics(BaseStatistics &stats) {
+	auto current_filter = GetFilter();
+	if (!current_filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return current_filter->CheckStatistics(stats);
+}
+
+DynamicFilter::DynamicFilter() : TableFilter(TableFilterType::DYNAMIC_FILTER) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return filter_data->CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	return "Dynamic Filter (" + column_name + ")";
+}
+
+unique_ptr<Expression> DynamicFilter::ToExpression(const Expression &column) const {
+	// the filter only prunes rows that would be discarded later on - not evaluating it does not change the result
+	return make_uniq<BoundConstantExpression>(Value::BOOLEAN(true));
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() const {
+	// copies of the filter share the filter data, so they observe updates to the filter
+	return make_uniq<DynamicFilter>(filter_data);
+}
+
+} // namespace duckdb
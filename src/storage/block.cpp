@@ -1,6 +1,7 @@
 #include "duckdb/storage/block.hpp"
 
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/file_system.hpp"
 
 namespace duckdb {
 
@@ -17,4 +18,20 @@ Block::Block(FileBuffer &source, block_id_t id) : FileBuffer(source, FileBufferT
 	D_ASSERT((AllocSize() & (Storage::SECTOR_SIZE - 1)) == 0);
 }
 
+MappedBlock::MappedBlock(Allocator &allocator, block_id_t id, shared_ptr<FileMemoryMapping> mapping_p,
+                         idx_t location, idx_t alloc_size)
+    : Block(allocator, id, idx_t(0)), mapping(std::move(mapping_p)) {
+	D_ASSERT(location + alloc_size <= mapping->size);
+	internal_buffer = mapping->data + location;
+	internal_size = alloc_size;
+	buffer = internal_buffer + Storage::DEFAULT_BLOCK_HEADER_SIZE;
+	size = internal_size - Storage::DEFAULT_BLOCK_HEADER_SIZE;
+}
+
+MappedBlock::~MappedBlock() {
+	// the memory belongs to the mapping - release its pages and prevent the FileBuffer from freeing it
+	mapping->Release(internal_buffer, internal_size);
+	Init();
+}
+
 } // namespace duckdb
@@ -93,6 +93,16 @@ MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
 
+void BlockManager::BatchReadBlocks(vector<BlockReadRequest> &requests) {
+	for (auto &request : requests) {
+		ReadBlocks(request.buffer, request.start_block, request.block_count);
+	}
+}
+
+unique_ptr<Block> BlockManager::MapBlock(block_id_t block_id) {
+	throw InternalException("This type of BlockManager does not support memory-mapping blocks");
+}
+
 void BlockManager::Truncate() {
 }
 
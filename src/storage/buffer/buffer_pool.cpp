@@ -200,16 +200,19 @@ BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps,
       allocator_bulk_deallocation_flush_threshold(allocator_bulk_deallocation_flush_threshold),
       track_eviction_timestamps(track_eviction_timestamps),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT + 1);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT + 1; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
+	probationary_evictions = 0;
+	huge_page_tags = 0;
 }
 BufferPool::~BufferPool() {
 }
 
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
+	auto queue_idx = GetEvictionQueueIndex(*handle);
+	auto &queue = *queues[queue_idx];
 
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
@@ -224,8 +227,10 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		// note that the previous version might live in a different queue if the block became hot in the meantime
+		queues[handle->eviction_queue_idx]->IncrementDeadNodes();
 	}
+	handle->eviction_queue_idx = NumericCast<uint8_t>(queue_idx);
 
 	// Get the eviction queue for the buffer type and add it
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
@@ -235,8 +240,70 @@ EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
 	return *queues[uint8_t(type) - 1];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+idx_t BufferPool::GetEvictionQueueIndex(const BlockHandle &handle) const {
+	auto type = handle.buffer->type;
+	if (type == FileBufferType::BLOCK && handle.hot) {
+		// the protected queue follows the queues of the file buffer types
+		return FILE_BUFFER_TYPE_COUNT;
+	}
+	return uint8_t(type) - 1;
+}
+
+void BufferPool::IncrementDeadNodes(const BlockHandle &handle) {
+	if (handle.eviction_seq_num == 0) {
+		// the block was never added to an eviction queue
+		GetEvictionQueueForType(handle.buffer->type).IncrementDeadNodes();
+		return;
+	}
+	queues[handle.eviction_queue_idx]->IncrementDeadNodes();
+}
+
+void BufferPool::RecordBlockAccess(BlockHandle &handle, BufferAccessPattern pattern, bool hit) {
+	access_statistics.Increment(handle.tag, hit);
+	if (handle.hot || handle.buffer->type != FileBufferType::BLOCK) {
+		return;
+	}
+	if (hit) {
+		// re-accessing a loaded block makes it hot, unless the access is part of a sequential scan
+		// sequential scans touch a block several times in quick succession, which says nothing about its reuse
+		handle.hot = pattern == BufferAccessPattern::RANDOM;
+		return;
+	}
+	if (handle.probationary_eviction_seq == 0) {
+		// the block has not been evicted from the probationary queue before
+		return;
+	}
+	// the block was evicted from the probationary queue before - it becomes hot if it was evicted so recently that it
+	// would still be in memory if the protected queue had half of the memory limit available to it
+	idx_t evictions_since = probationary_evictions.load() - handle.probationary_eviction_seq;
+	idx_t history_size = maximum_memory / (2 * MaxValue<idx_t>(handle.memory_usage, 1));
+	handle.hot = evictions_since < history_size;
+}
+
+void BufferPool::RecordBlockEviction(EvictionQueue &queue, BlockHandle &handle) {
+	if (&queue == &GetEvictionQueueForType(FileBufferType::BLOCK)) {
+		handle.probationary_eviction_seq = ++probationary_evictions;
+	} else {
+		// blocks that are evicted from the protected queue have to prove that they are hot again
+		handle.probationary_eviction_seq = 0;
+	}
+	handle.hot = false;
+}
+
+idx_t BufferPool::GetBufferHits(MemoryTag tag) const {
+	return BufferAccessStatistics::Sum(access_statistics.hits, tag);
+}
+
+idx_t BufferPool::GetBufferMisses(MemoryTag tag) const {
+	return BufferAccessStatistics::Sum(access_statistics.misses, tag);
+}
+
+void BufferPool::SetHugePageTags(const vector<MemoryTag> &tags) {
+	idx_t mask = 0;
+	for (auto &tag : tags) {
+		mask |= idx_t(1) << static_cast<uint8_t>(tag);
+	}
+	huge_page_tags = mask;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -261,13 +328,20 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
+	// First, we try to evict persistent table data that has not proven to be hot
 	auto block_result =
 	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
 	if (block_result.success) {
 		return block_result;
 	}
 
+	// Then, we try to evict hot persistent table data
+	auto protected_result =
+	    EvictBlocksInternal(*queues[FILE_BUFFER_TYPE_COUNT], tag, extra_memory, memory_limit, buffer);
+	if (protected_result.success) {
+		return protected_result;
+	}
+
 	// If that does not succeed, we try to evict temporary data
 	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
 	                                                 extra_memory, memory_limit, buffer);
@@ -294,7 +368,8 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
+		RecordBlockEviction(queue, *handle);
+		if (buffer && handle->buffer->AllocSize() == extra_memory && !handle->IsMemoryMapped()) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
 			found = true;
@@ -340,6 +415,7 @@ idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age
 		// We will unload this block regardless. But stop the iteration immediately afterward if this
 		// block is younger than the age threshold.
 		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
+		RecordBlockEviction(queue, *handle);
 		purged_bytes += handle->GetMemoryUsage();
 		handle->Unload();
 		return is_fresh;
@@ -383,6 +459,9 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	if (type == FileBufferType::BLOCK) {
+		queues[FILE_BUFFER_TYPE_COUNT]->Purge();
+	}
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -452,4 +531,32 @@ void BufferPool::MemoryUsage::UpdateUsedMemory(MemoryTag tag, int64_t size) {
 	}
 }
 
+BufferPool::BufferAccessStatistics::BufferAccessStatistics() {
+	for (auto &shard : hits) {
+		for (auto &v : shard) {
+			v = 0;
+		}
+	}
+	for (auto &shard : misses) {
+		for (auto &v : shard) {
+			v = 0;
+		}
+	}
+}
+
+void BufferPool::BufferAccessStatistics::Increment(MemoryTag tag, bool hit) {
+	auto shard_idx = (idx_t)TaskScheduler::GetEstimatedCPUId() % SHARD_COUNT;
+	auto &counters = hit ? hits[shard_idx] : misses[shard_idx];
+	counters[(idx_t)tag].fetch_add(1, std::memory_order_relaxed);
+}
+
+idx_t BufferPool::BufferAccessStatistics::Sum(const array<BufferAccessCounters, SHARD_COUNT> &counters,
+                                              MemoryTag tag) {
+	idx_t result = 0;
+	for (auto &shard : counters) {
+		result += shard[(idx_t)tag].load(std::memory_order_relaxed);
+	}
+	return result;
+}
+
 } // namespace duckdb
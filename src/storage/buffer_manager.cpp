@@ -8,6 +8,11 @@
 
 namespace duckdb {
 
+BufferHandle BufferManager::Pin(shared_ptr<BlockHandle> &handle, BufferAccessPattern pattern) {
+	// buffer managers that do not distinguish access patterns treat every pin the same
+	return Pin(handle);
+}
+
 shared_ptr<BlockHandle> BufferManager::RegisterTransientMemory(const idx_t size, const idx_t block_size) {
 	throw NotImplementedException("This type of BufferManager can not create 'transient-memory' blocks");
 }
@@ -20,6 +25,14 @@ Allocator &BufferManager::GetBufferAllocator() {
 	throw NotImplementedException("This type of BufferManager does not have an Allocator");
 }
 
+Allocator &BufferManager::GetBufferAllocator(MemoryTag tag) {
+	return GetBufferAllocator();
+}
+
+void BufferManager::AdviseHugePages(MemoryTag tag, data_ptr_t pointer, idx_t size) {
+	// no huge page support by default
+}
+
 void BufferManager::ReserveMemory(idx_t size) {
 	throw NotImplementedException("This type of BufferManager can not reserve memory");
 }
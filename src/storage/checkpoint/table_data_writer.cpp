@@ -26,6 +26,14 @@ CompressionType TableDataWriter::GetColumnCompressionType(idx_t i) {
 	return table.GetColumn(LogicalIndex(i)).CompressionType();
 }
 
+vector<idx_t> TableDataWriter::GetClusterColumns() {
+	vector<idx_t> result;
+	for (auto &column_name : table.GetClusterBy()) {
+		result.push_back(table.GetColumn(column_name).StorageOid());
+	}
+	return result;
+}
+
 void TableDataWriter::AddRowGroup(RowGroupPointer &&row_group_pointer, unique_ptr<RowGroupWriter> writer) {
 	row_group_pointers.push_back(std::move(row_group_pointer));
 }
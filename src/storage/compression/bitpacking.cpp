@@ -624,9 +624,11 @@ static T DeltaDecode(T *data, T previous_value, const size_t size) {
 template <class T, class T_S = typename MakeSigned<T>::type>
 struct BitpackingScanState : public SegmentScanState {
 public:
-	explicit BitpackingScanState(ColumnSegment &segment) : current_segment(segment) {
+	explicit BitpackingScanState(ColumnSegment &segment,
+	                             BufferAccessPattern pattern = BufferAccessPattern::SEQUENTIAL)
+	    : current_segment(segment) {
 		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
-		handle = buffer_manager.Pin(segment.block);
+		handle = buffer_manager.Pin(segment.block, pattern);
 		auto data_ptr = handle.Ptr();
 
 		// load offset to bitpacking widths pointer
@@ -887,7 +889,7 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 template <class T>
 void BitpackingFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
                         idx_t result_idx) {
-	BitpackingScanState<T> scan_state(segment);
+	BitpackingScanState<T> scan_state(segment, BufferAccessPattern::RANDOM);
 	scan_state.Skip(segment, NumericCast<idx_t>(row_id));
 
 	D_ASSERT(scan_state.current_group_offset < BITPACKING_METADATA_GROUP_SIZE);
@@ -449,7 +449,7 @@ struct CompressedStringScanState : public StringScanState {
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
 	auto state = make_uniq<CompressedStringScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
-	state->handle = buffer_manager.Pin(segment.block);
+	state->handle = buffer_manager.Pin(segment.block, BufferAccessPattern::SEQUENTIAL);
 
 	auto baseptr = state->handle.Ptr() + segment.GetBlockOffset();
 
@@ -131,7 +131,7 @@ struct FixedSizeScanState : public SegmentScanState {
 unique_ptr<SegmentScanState> FixedSizeInitScan(ColumnSegment &segment) {
 	auto result = make_uniq<FixedSizeScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
-	result->handle = buffer_manager.Pin(segment.block);
+	result->handle = buffer_manager.Pin(segment.block, BufferAccessPattern::SEQUENTIAL);
 	return std::move(result);
 }
 
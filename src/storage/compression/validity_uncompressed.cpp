@@ -210,7 +210,7 @@ struct ValidityScanState : public SegmentScanState {
 unique_ptr<SegmentScanState> ValidityInitScan(ColumnSegment &segment) {
 	auto result = make_uniq<ValidityScanState>();
 	auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
-	result->handle = buffer_manager.Pin(segment.block);
+	result->handle = buffer_manager.Pin(segment.block, BufferAccessPattern::SEQUENTIAL);
 	result->block_id = segment.block->BlockId();
 	return std::move(result);
 }
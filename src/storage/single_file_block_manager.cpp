@@ -246,6 +246,12 @@ void SingleFileBlockManager::LoadExistingDatabase() {
 	ReadAndChecksum(header_buffer, Storage::FILE_HEADER_SIZE * 2ULL);
 	h2 = DeserializeHeaderStructure<DatabaseHeader>(header_buffer.buffer);
 
+	if (options.read_only && options.use_mmap && !options.use_direct_io) {
+		// map the file before any block is registered, so that all blocks are loaded from the mapping
+		// the file cannot grow while we hold the read lock, so we can map all of it
+		mapping = fs.MapFile(*handle, NumericCast<idx_t>(handle->GetFileSize()));
+	}
+
 	// check the header with the highest iteration count
 	if (h1.iteration > h2.iteration) {
 		// h1 is active header
@@ -523,6 +529,19 @@ void SingleFileBlockManager::Read(Block &block) {
 	ReadAndChecksum(block, GetBlockLocation(block.id));
 }
 
+unique_ptr<Block> SingleFileBlockManager::MapBlock(block_id_t block_id) {
+	D_ASSERT(mapping);
+	D_ASSERT(block_id >= 0);
+	auto location = GetBlockLocation(block_id);
+	if (location + GetBlockAllocSize() > mapping->size) {
+		throw IOException("Corrupt database file: block %llu at location %llu lies beyond the end of the file",
+		                  block_id, location);
+	}
+	auto block = make_uniq<MappedBlock>(Allocator::Get(db), block_id, mapping, location, GetBlockAllocSize());
+	VerifyBlockChecksums(*block, block_id, 1);
+	return std::move(block);
+}
+
 void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	D_ASSERT(start_block >= 0);
 	D_ASSERT(block_count >= 1);
@@ -531,7 +550,28 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
 
+	VerifyBlockChecksums(buffer, start_block, block_count);
+}
+
+void SingleFileBlockManager::BatchReadBlocks(vector<BlockReadRequest> &requests) {
+	// issue all reads at once
+	vector<FileReadRequest> read_requests;
+	for (auto &request : requests) {
+		D_ASSERT(request.start_block >= 0);
+		D_ASSERT(request.block_count >= 1);
+		auto &buffer = request.buffer;
+		read_requests.emplace_back(buffer.InternalBuffer(), buffer.AllocSize(), GetBlockLocation(request.start_block));
+	}
+	handle->ReadBatch(read_requests);
+
+	for (auto &request : requests) {
+		VerifyBlockChecksums(request.buffer, request.start_block, request.block_count);
+	}
+}
+
+void SingleFileBlockManager::VerifyBlockChecksums(FileBuffer &buffer, block_id_t start_block, idx_t block_count) {
 	// for each of the blocks - verify the checksum
+	auto location = GetBlockLocation(start_block);
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
 		// compute the checksum
@@ -6,6 +6,7 @@
 #include "duckdb/common/set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
@@ -21,10 +22,12 @@ static void WriteGarbageIntoBuffer(FileBuffer &buffer) {
 #endif
 
 struct BufferAllocatorData : PrivateAllocatorData {
-	explicit BufferAllocatorData(StandardBufferManager &manager) : manager(manager) {
+	BufferAllocatorData(StandardBufferManager &manager, MemoryTag tag) : manager(manager), tag(tag) {
 	}
 
 	StandardBufferManager &manager;
+	//! The memory tag that the allocations are charged to
+	MemoryTag tag;
 };
 
 unique_ptr<FileBuffer> StandardBufferManager::ConstructManagedBuffer(idx_t size, unique_ptr<FileBuffer> &&source,
@@ -51,9 +54,12 @@ void StandardBufferManager::SetTemporaryDirectory(const string &new_dir) {
 }
 
 StandardBufferManager::StandardBufferManager(DatabaseInstance &db, string tmp)
-    : BufferManager(), db(db), buffer_pool(db.GetBufferPool()), temporary_id(MAXIMUM_BLOCK),
-      buffer_allocator(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc,
-                       make_uniq<BufferAllocatorData>(*this)) {
+    : BufferManager(), db(db), buffer_pool(db.GetBufferPool()), temporary_id(MAXIMUM_BLOCK) {
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		auto data = make_uniq<BufferAllocatorData>(*this, MemoryTag(i));
+		buffer_allocators[i] =
+		    make_uniq<Allocator>(BufferAllocatorAllocate, BufferAllocatorFree, BufferAllocatorRealloc, std::move(data));
+	}
 	temp_block_manager = make_uniq<InMemoryBlockManager>(*this, DEFAULT_BLOCK_ALLOC_SIZE);
 	temporary_directory.path = std::move(tmp);
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
@@ -158,6 +164,7 @@ shared_ptr<BlockHandle> StandardBufferManager::RegisterMemory(MemoryTag tag, idx
 
 	// Create a new buffer and a block to hold the buffer.
 	auto buffer = ConstructManagedBuffer(block_size, std::move(reusable_buffer));
+	AdviseHugePages(tag, buffer->InternalBuffer(), buffer->AllocSize());
 	DestroyBufferUpon destroy_buffer_upon = can_destroy ? DestroyBufferUpon::EVICTION : DestroyBufferUpon::BLOCK;
 	return make_shared_ptr<BlockHandle>(*temp_block_manager, ++temporary_id, tag, std::move(buffer),
 	                                    destroy_buffer_upon, alloc_size, std::move(res));
@@ -206,61 +213,73 @@ void StandardBufferManager::ReAllocate(shared_ptr<BlockHandle> &handle, idx_t bl
 }
 
 void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
-                                      block_id_t first_block, block_id_t last_block) {
+                                      const vector<pair<block_id_t, idx_t>> &block_ranges) {
 	auto &block_manager = handles[0]->block_manager;
-	idx_t block_count = NumericCast<idx_t>(last_block - first_block + 1);
-#ifndef DUCKDB_ALTERNATIVE_VERIFY
-	if (block_count == 1) {
-		// prefetching with block_count == 1 has no performance impact since we can't batch reads
-		// skip the prefetch in this case
-		// we do it anyway if alternative_verify is on for extra testing
-		return;
-	}
-#endif
 
-	// allocate a buffer to hold the data of all of the blocks
-	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
-	// perform a batch read of the blocks into the buffer
-	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	// allocate a buffer to hold the data of each range of blocks
+	vector<BufferHandle> intermediate_buffers;
+	vector<BlockReadRequest> read_requests;
+	intermediate_buffers.reserve(block_ranges.size());
+	for (auto &range : block_ranges) {
+		intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, range.second * block_manager.GetBlockSize()));
+		read_requests.emplace_back(intermediate_buffers.back().GetFileBuffer(), range.first, range.second);
+	}
+	// perform a batch read of all of the ranges
+	block_manager.BatchReadBlocks(read_requests);
 
 	// the blocks are read - now we need to assign them to the individual blocks
-	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
-		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
-		auto entry = load_map.find(block_id);
-		D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
-		auto &handle = handles[entry->second];
-
-		// reserve memory for the block
-		idx_t required_memory = handle->memory_usage;
-		unique_ptr<FileBuffer> reusable_buffer;
-		auto reservation =
-		    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
-		                       StringUtil::BytesToHumanReadableString(required_memory));
-		// now load the block from the buffer
-		// note that we discard the buffer handle - we do not keep it around
-		// the prefetching relies on the block handle being pinned again during the actual read before it is evicted
-		BufferHandle buf;
-		{
-			lock_guard<mutex> lock(handle->lock);
-			if (handle->state == BlockState::BLOCK_LOADED) {
-				// the block is loaded already by another thread - free up the reservation and continue
-				reservation.Resize(0);
-				continue;
+	for (idx_t range_idx = 0; range_idx < block_ranges.size(); range_idx++) {
+		auto first_block = block_ranges[range_idx].first;
+		auto block_count = block_ranges[range_idx].second;
+		auto &intermediate_buffer = intermediate_buffers[range_idx];
+		for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
+			block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
+			auto entry = load_map.find(block_id);
+			D_ASSERT(entry != load_map.end()); // if we allow gaps we might not return true here
+			auto &handle = handles[entry->second];
+
+			// reserve memory for the block
+			idx_t required_memory = handle->memory_usage;
+			unique_ptr<FileBuffer> reusable_buffer;
+			auto reservation =
+			    EvictBlocksOrThrow(handle->tag, required_memory, &reusable_buffer, "failed to pin block of size %s%s",
+			                       StringUtil::BytesToHumanReadableString(required_memory));
+			// now load the block from the buffer
+			// note that we discard the buffer handle - we do not keep it around
+			// the prefetching relies on the block handle being pinned again during the actual read before it is
+			// evicted
+			BufferHandle buf;
+			{
+				lock_guard<mutex> lock(handle->lock);
+				if (handle->state == BlockState::BLOCK_LOADED) {
+					// the block is loaded already by another thread - free up the reservation and continue
+					reservation.Resize(0);
+					continue;
+				}
+				auto block_ptr = intermediate_buffer.GetFileBuffer().InternalBuffer() +
+				                 block_idx * block_manager.GetBlockAllocSize();
+				buf = handle->LoadFromBuffer(block_ptr, std::move(reusable_buffer));
+				handle->readers = 1;
+				handle->memory_charge = std::move(reservation);
+				// prefetching is only done by scans
+				buffer_pool.RecordBlockAccess(*handle, BufferAccessPattern::SEQUENTIAL, false);
 			}
-			auto block_ptr =
-			    intermediate_buffer.GetFileBuffer().InternalBuffer() + block_idx * block_manager.GetBlockAllocSize();
-			buf = handle->LoadFromBuffer(block_ptr, std::move(reusable_buffer));
-			handle->readers = 1;
-			handle->memory_charge = std::move(reservation);
 		}
 	}
 }
 
 void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
+	// the maximum amount of block ranges that are read in a single batch
+	static constexpr const idx_t MAX_BATCH_READ_RANGES = 64;
+
 	// figure out which set of blocks we should load
 	map<block_id_t, idx_t> to_be_loaded;
 	for (idx_t block_idx = 0; block_idx < handles.size(); block_idx++) {
 		auto &handle = handles[block_idx];
+		if (handle->IsMemoryMapped()) {
+			// memory-mapped blocks are read by the operating system on access
+			continue;
+		}
 		lock_guard<mutex> lock(handle->lock);
 		if (handle->state != BlockState::BLOCK_LOADED) {
 			// need to load this block - add it to the map
@@ -271,32 +290,54 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
-	block_id_t first_block = -1;
-	block_id_t previous_block_id = -1;
+#ifndef DUCKDB_ALTERNATIVE_VERIFY
+	if (to_be_loaded.size() == 1) {
+		// prefetching a single block has no performance impact since there is nothing to batch
+		// skip the prefetch in this case
+		// we do it anyway if alternative_verify is on for extra testing
+		return;
+	}
+#endif
+	// the blocks of a batch are held twice while they are copied out of the intermediate buffers
+	// cap the size of a batch so that every thread can prefetch at the same time without exceeding the memory limit
+	auto block_alloc_size = handles[0]->block_manager.GetBlockAllocSize();
+	auto max_memory = GetMaxMemory();
+	auto used_memory = GetUsedMemory();
+	auto free_memory = max_memory > used_memory ? max_memory - used_memory : 0;
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(db).NumberOfThreads());
+	auto max_batch_blocks = MaxValue<idx_t>(free_memory / (2 * thread_count * block_alloc_size), 1);
+
+	// gather the ranges of adjacent blocks - each range is read with a single read
+	vector<pair<block_id_t, idx_t>> block_ranges;
 	for (auto &entry : to_be_loaded) {
-		if (previous_block_id < 0) {
-			// this the first block we are seeing
-			first_block = entry.first;
-			previous_block_id = first_block;
-		} else if (previous_block_id + 1 == entry.first) {
-			// this block is adjacent to the previous block - add it to the batch read
-			previous_block_id = entry.first;
-		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
-
-			// set the first_block and previous_block_id to the current block
-			first_block = entry.first;
-			previous_block_id = entry.first;
+		if (!block_ranges.empty() && block_ranges.back().second < max_batch_blocks &&
+		    block_ranges.back().first + NumericCast<block_id_t>(block_ranges.back().second) == entry.first) {
+			// this block is adjacent to the previous block - add it to the range
+			block_ranges.back().second++;
+			continue;
 		}
+		block_ranges.emplace_back(entry.first, 1);
+	}
+	// perform the reads of the ranges in batches, so that the reads of a batch can be in flight concurrently
+	vector<pair<block_id_t, idx_t>> batch;
+	idx_t batch_blocks = 0;
+	for (auto &range : block_ranges) {
+		if (!batch.empty() && (batch.size() == MAX_BATCH_READ_RANGES || batch_blocks + range.second > max_batch_blocks)) {
+			BatchRead(handles, to_be_loaded, batch);
+			batch.clear();
+			batch_blocks = 0;
+		}
+		batch.push_back(range);
+		batch_blocks += range.second;
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	BatchRead(handles, to_be_loaded, batch);
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
+	return Pin(handle, BufferAccessPattern::RANDOM);
+}
+
+BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle, BufferAccessPattern pattern) {
 	// we need to be careful not to return the BufferHandle to this block while holding the BlockHandle's lock
 	// as exiting this function's scope may cause the destructor of the BufferHandle to be called while holding the lock
 	// the destructor calls Unpin, which grabs the BlockHandle's lock again, causing a deadlock
@@ -311,6 +352,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			// the block is loaded, increment the reader count and set the BufferHandle
 			handle->readers++;
 			buf = handle->Load();
+			buffer_pool.RecordBlockAccess(*handle, pattern, true);
 		}
 		required_memory = handle->memory_usage;
 	}
@@ -332,6 +374,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			handle->readers++;
 			reservation.Resize(0);
 			buf = handle->Load();
+			buffer_pool.RecordBlockAccess(*handle, pattern, true);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
@@ -347,6 +390,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 				handle->memory_charge.Resize(handle->memory_usage);
 			}
 			D_ASSERT(handle->memory_usage == handle->buffer->AllocSize());
+			buffer_pool.RecordBlockAccess(*handle, pattern, false);
 		}
 	}
 
@@ -419,6 +463,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage.GetUsedMemory(MemoryTag(k), BufferPool::MemoryUsageCaches::FLUSH);
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.buffer_hits = buffer_pool.GetBufferHits(MemoryTag(k));
+		info.buffer_misses = buffer_pool.GetBufferMisses(MemoryTag(k));
 		result.push_back(info);
 	}
 	return result;
@@ -568,6 +614,9 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.slot_size = info.size;
+		info.block_count = 1;
+		info.uncompressed_size = info.size;
 		handle.reset();
 		result.push_back(info);
 	});
@@ -607,7 +656,7 @@ void StandardBufferManager::FreeReservedMemory(idx_t size) {
 data_ptr_t StandardBufferManager::BufferAllocatorAllocate(PrivateAllocatorData *private_data, idx_t size) {
 	auto &data = private_data->Cast<BufferAllocatorData>();
 	auto reservation =
-	    data.manager.EvictBlocksOrThrow(MemoryTag::ALLOCATOR, size, nullptr, "failed to allocate data of size %s%s",
+	    data.manager.EvictBlocksOrThrow(data.tag, size, nullptr, "failed to allocate data of size %s%s",
 	                                    StringUtil::BytesToHumanReadableString(size));
 	// We rely on manual tracking of this one. :(
 	reservation.size = 0;
@@ -616,7 +665,7 @@ data_ptr_t StandardBufferManager::BufferAllocatorAllocate(PrivateAllocatorData *
 
 void StandardBufferManager::BufferAllocatorFree(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size) {
 	auto &data = private_data->Cast<BufferAllocatorData>();
-	BufferPoolReservation r(MemoryTag::ALLOCATOR, data.manager.GetBufferPool());
+	BufferPoolReservation r(data.tag, data.manager.GetBufferPool());
 	r.size = size;
 	r.Resize(0);
 	return Allocator::Get(data.manager.db).FreeData(pointer, size);
@@ -628,10 +677,20 @@ data_ptr_t StandardBufferManager::BufferAllocatorRealloc(PrivateAllocatorData *p
 		return pointer;
 	}
 	auto &data = private_data->Cast<BufferAllocatorData>();
-	BufferPoolReservation r(MemoryTag::ALLOCATOR, data.manager.GetBufferPool());
-	r.size = old_size;
-	r.Resize(size);
-	r.size = 0;
+	if (size > old_size) {
+		// growing the allocation: make space for the additional memory first
+		auto reservation = data.manager.EvictBlocksOrThrow(data.tag, size - old_size, nullptr,
+		                                                   "failed to reallocate data of size %s to size %s%s",
+		                                                   StringUtil::BytesToHumanReadableString(old_size),
+		                                                   StringUtil::BytesToHumanReadableString(size));
+		// We rely on manual tracking of this one. :(
+		reservation.size = 0;
+	} else {
+		BufferPoolReservation r(data.tag, data.manager.GetBufferPool());
+		r.size = old_size;
+		r.Resize(size);
+		r.size = 0;
+	}
 	return Allocator::Get(data.manager.db).ReallocateData(pointer, old_size, size);
 }
 
@@ -648,8 +707,27 @@ Allocator &BufferAllocator::Get(AttachedDatabase &db) {
 	return BufferAllocator::Get(db.GetDatabase());
 }
 
+Allocator &BufferAllocator::Get(ClientContext &context, MemoryTag tag) {
+	return BufferManager::GetBufferManager(context).GetBufferAllocator(tag);
+}
+
+Allocator &BufferAllocator::Get(DatabaseInstance &db, MemoryTag tag) {
+	return BufferManager::GetBufferManager(db).GetBufferAllocator(tag);
+}
+
 Allocator &StandardBufferManager::GetBufferAllocator() {
-	return buffer_allocator;
+	return *buffer_allocators[static_cast<uint8_t>(MemoryTag::ALLOCATOR)];
+}
+
+Allocator &StandardBufferManager::GetBufferAllocator(MemoryTag tag) {
+	return *buffer_allocators[static_cast<uint8_t>(tag)];
+}
+
+void StandardBufferManager::AdviseHugePages(MemoryTag tag, data_ptr_t pointer, idx_t size) {
+	if (size < Allocator::HUGE_PAGE_SIZE || !buffer_pool.UseHugePages(tag)) {
+		return;
+	}
+	Allocator::AdviseHugePages(pointer, size);
 }
 
 } // namespace duckdb
@@ -152,6 +152,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 
 	auto &fs = FileSystem::Get(db);
 	auto &config = DBConfig::Get(db);
+	bool checkpoint_after_replay = false;
 	if (!config.options.enable_external_access) {
 		if (!db.IsInitialDatabase()) {
 			throw PermissionException("Attaching on-disk databases is disabled through configuration");
@@ -161,6 +162,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 	StorageManagerOptions options;
 	options.read_only = read_only;
 	options.use_direct_io = config.options.use_direct_io;
+	options.use_mmap = config.options.mmap_read_only_databases;
 	options.debug_initialize = config.options.debug_initialize;
 
 	// Check if the database file already exists.
@@ -219,13 +221,24 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 		auto handle = fs.OpenFile(wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
 		if (handle) {
 			// replay the WAL
+			auto replayed_wal_size = NumericCast<idx_t>(fs.GetFileSize(*handle));
 			if (WriteAheadLog::Replay(db, std::move(handle))) {
 				fs.RemoveFile(wal_path);
+			} else if (!read_only && replayed_wal_size >= config.options.checkpoint_wal_size) {
+				// the replayed WAL is large enough that the next commit would checkpoint anyway
+				checkpoint_after_replay = true;
 			}
 		}
 	}
 
 	load_complete = true;
+	if (checkpoint_after_replay) {
+		// checkpoint right away, so the replayed data is written to the database file (in parallel) and the WAL
+		// does not have to be replayed again on the next restart
+		CheckpointOptions checkpoint_options;
+		checkpoint_options.wal_action = CheckpointWALAction::DELETE_WAL;
+		CreateCheckpoint(checkpoint_options);
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -262,11 +275,14 @@ private:
 	idx_t initial_written = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
+	//! Whether or not the sync of the WAL is deferred to a group commit
+	bool group_commit;
 	reference_map_t<DataTable, unordered_map<idx_t, OptimisticallyWrittenRowGroupData>> optimistically_written_data;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage, WriteAheadLog &wal)
-    : wal(wal), state(WALCommitState::IN_PROGRESS) {
+    : wal(wal), state(WALCommitState::IN_PROGRESS),
+      group_commit(DBConfig::Get(storage.GetAttached()).options.wal_group_commit) {
 	auto initial_size = storage.GetWALSize();
 	initial_written = wal.GetTotalWritten();
 	initial_wal_size = initial_size;
@@ -298,7 +314,12 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	if (group_commit) {
+		// the transaction manager syncs the WAL after releasing its locks, so concurrent commits can share the sync
+		wal.FlushWithoutSync();
+	} else {
+		wal.Flush();
+	}
 	state = WALCommitState::FLUSHED;
 }
 
@@ -112,9 +112,15 @@ void PartialBlockForCheckpoint::Clear() {
 	segments.clear();
 }
 
+void ColumnCheckpointFlushQueue::Flush() {
+	for (auto &entry : entries) {
+		entry.state.get().FlushSegmentInternal(entry.segment.get(), entry.segment_size);
+	}
+	entries.clear();
+}
+
 void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_t segment_size) {
-	auto block_size = partial_block_manager.GetBlockManager().GetBlockSize();
-	D_ASSERT(segment_size <= block_size);
+	D_ASSERT(segment_size <= partial_block_manager.GetBlockManager().GetBlockSize());
 
 	auto tuple_count = segment->count.load();
 	if (tuple_count == 0) { // LCOV_EXCL_START
@@ -124,6 +130,21 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	// merge the segment stats into the global stats
 	global_stats->Merge(segment->stats.statistics);
 
+	if (flush_queue) {
+		// the segment is assigned to a block later on - see ColumnCheckpointFlushQueue::Flush
+		flush_queue->entries.emplace_back(*this, *segment, segment_size);
+	} else {
+		FlushSegmentInternal(*segment, segment_size);
+	}
+	// append the segment to the new segment tree
+	new_tree.AppendSegment(std::move(segment));
+}
+
+void ColumnCheckpointState::FlushSegmentInternal(ColumnSegment &segment, idx_t segment_size) {
+	auto block_size = partial_block_manager.GetBlockManager().GetBlockSize();
+	D_ASSERT(segment_size <= block_size);
+	auto tuple_count = segment.count.load();
+
 	// get the buffer of the segment and pin it
 	auto &db = column_data.GetDatabase();
 	auto &buffer_manager = BufferManager::GetBufferManager(db);
@@ -131,7 +152,7 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 	uint32_t offset_in_block = 0;
 
 	unique_lock<mutex> partial_block_lock;
-	if (!segment->stats.statistics.IsConstant()) {
+	if (!segment.stats.statistics.IsConstant()) {
 		partial_block_lock = partial_block_manager.GetLock();
 
 		// non-constant block
@@ -145,22 +166,22 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 			D_ASSERT(offset_in_block > 0);
 			auto &pstate = allocation.partial_block->Cast<PartialBlockForCheckpoint>();
 			// pin the source block
-			auto old_handle = buffer_manager.Pin(segment->block);
+			auto old_handle = buffer_manager.Pin(segment.block);
 			// pin the target block
 			auto new_handle = buffer_manager.Pin(pstate.block_handle);
 			// memcpy the contents of the old block to the new block
 			memcpy(new_handle.Ptr() + offset_in_block, old_handle.Ptr(), segment_size);
-			pstate.AddSegmentToTail(column_data, *segment, offset_in_block);
+			pstate.AddSegmentToTail(column_data, segment, offset_in_block);
 		} else {
 			// Create a new block for future reuse.
-			if (segment->SegmentSize() != block_size) {
+			if (segment.SegmentSize() != block_size) {
 				// the segment is smaller than the block size
 				// allocate a new block and copy the data over
-				D_ASSERT(segment->SegmentSize() < block_size);
-				segment->Resize(block_size);
+				D_ASSERT(segment.SegmentSize() < block_size);
+				segment.Resize(block_size);
 			}
 			D_ASSERT(offset_in_block == 0);
-			allocation.partial_block = make_uniq<PartialBlockForCheckpoint>(column_data, *segment, allocation.state,
+			allocation.partial_block = make_uniq<PartialBlockForCheckpoint>(column_data, segment, allocation.state,
 			                                                                *allocation.block_manager);
 		}
 		// Writer will decide whether to reuse this block.
@@ -169,13 +190,13 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 		// constant block: no need to write anything to disk besides the stats
 		// set up the compression function to constant
 		auto &config = DBConfig::GetConfig(db);
-		segment->function =
-		    *config.GetCompressionFunction(CompressionType::COMPRESSION_CONSTANT, segment->type.InternalType());
-		segment->ConvertToPersistent(nullptr, INVALID_BLOCK);
+		segment.function =
+		    *config.GetCompressionFunction(CompressionType::COMPRESSION_CONSTANT, segment.type.InternalType());
+		segment.ConvertToPersistent(nullptr, INVALID_BLOCK);
 	}
 
 	// construct the data pointer
-	DataPointer data_pointer(segment->stats.statistics.Copy());
+	DataPointer data_pointer(segment.stats.statistics.Copy());
 	data_pointer.block_pointer.block_id = block_id;
 	data_pointer.block_pointer.offset = offset_in_block;
 	data_pointer.row_start = row_group.start;
@@ -184,13 +205,10 @@ void ColumnCheckpointState::FlushSegment(unique_ptr<ColumnSegment> segment, idx_
 		data_pointer.row_start = last_pointer.row_start + last_pointer.tuple_count;
 	}
 	data_pointer.tuple_count = tuple_count;
-	data_pointer.compression_type = segment->function.get().type;
-	if (segment->function.get().serialize_state) {
-		data_pointer.segment_state = segment->function.get().serialize_state(*segment);
+	data_pointer.compression_type = segment.function.get().type;
+	if (segment.function.get().serialize_state) {
+		data_pointer.segment_state = segment.function.get().serialize_state(segment);
 	}
-
-	// append the segment to the new segment tree
-	new_tree.AppendSegment(std::move(segment));
 	data_pointers.push_back(std::move(data_pointer));
 }
 
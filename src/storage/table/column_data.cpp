@@ -562,6 +562,7 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Co
 	// set up the checkpoint state
 	auto checkpoint_state = CreateCheckpointState(row_group, checkpoint_info.info.manager);
 	checkpoint_state->global_stats = BaseStatistics::CreateEmpty(type).ToUnique();
+	checkpoint_state->flush_queue = checkpoint_info.flush_queue;
 
 	auto l = data.Lock();
 	auto nodes = data.MoveSegments(l);
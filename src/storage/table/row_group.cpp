@@ -419,6 +419,7 @@ static idx_t GetFilterScanCount(ColumnScanState &state, TableFilter &filter) {
 	case TableFilterType::IS_NULL:
 	case TableFilterType::IS_NOT_NULL:
 	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::DYNAMIC_FILTER:
 		return state.current->start + state.current->count;
 	default: {
 		throw NotImplementedException("Unimplemented filter type for zonemap");
@@ -885,11 +886,16 @@ CompressionType ColumnCheckpointInfo::GetCompressionType() {
 	return info.compression_types[column_idx];
 }
 
-RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
-	RowGroupWriteData result;
-	result.states.reserve(columns.size());
-	result.statistics.reserve(columns.size());
+unique_ptr<ColumnCheckpointState> RowGroup::WriteColumnToDisk(RowGroupWriteInfo &info, idx_t column_idx,
+                                                             optional_ptr<ColumnCheckpointFlushQueue> flush_queue) {
+	auto &column = GetColumn(column_idx);
+	ColumnCheckpointInfo checkpoint_info(info, column_idx, flush_queue);
+	auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
+	D_ASSERT(checkpoint_state);
+	return checkpoint_state;
+}
 
+RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// Checkpoint the individual columns of the row group
 	// Here we're iterating over columns. Each column can have multiple segments.
 	// (Some columns will be wider than others, and require different numbers
@@ -898,12 +904,19 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// Some of these columns are composite (list, struct). The data is written
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
+	vector<unique_ptr<ColumnCheckpointState>> states;
+	states.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
-		auto &column = GetColumn(column_idx);
-		ColumnCheckpointInfo checkpoint_info(info, column_idx);
-		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
-		D_ASSERT(checkpoint_state);
+		states.push_back(WriteColumnToDisk(info, column_idx));
+	}
+	return GetWriteData(std::move(states));
+}
 
+RowGroupWriteData RowGroup::GetWriteData(vector<unique_ptr<ColumnCheckpointState>> states) {
+	RowGroupWriteData result;
+	result.states.reserve(states.size());
+	result.statistics.reserve(states.size());
+	for (auto &checkpoint_state : states) {
 		auto stats = checkpoint_state->GetStatistics();
 		D_ASSERT(stats);
 
@@ -931,7 +944,7 @@ bool RowGroup::HasUnloadedDeletes() const {
 	return !deletes_is_loaded;
 }
 
-RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+vector<CompressionType> RowGroup::GetCompressionTypes(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
@@ -943,7 +956,11 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 		}
 		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
+	return compression_types;
+}
 
+RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
+	auto compression_types = GetCompressionTypes(writer);
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
 	return WriteToDisk(info);
 }
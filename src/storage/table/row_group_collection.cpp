@@ -1,12 +1,15 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
 
 #include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/sort/sort.hpp"
+#include "duckdb/common/sort/sorted_block.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/metadata/metadata_reader.hpp"
@@ -56,7 +59,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), requires_clustering(false) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -319,6 +322,7 @@ bool RowGroupCollection::IsEmpty(SegmentLock &l) const {
 }
 
 void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppendState &state) {
+	requires_clustering = true;
 	state.row_start = UnsafeNumericCast<row_t>(total_rows.load());
 	state.current_row = state.row_start;
 	state.total_append_count = 0;
@@ -502,6 +506,7 @@ bool RowGroupCollection::IsPersistent() const {
 void RowGroupCollection::MergeStorage(RowGroupCollection &data, optional_ptr<DataTable> table,
                                       optional_ptr<StorageCommitState> commit_state) {
 	D_ASSERT(data.types == types);
+	requires_clustering = true;
 	auto start_index = row_start + total_rows.load();
 	auto index = start_index;
 	auto segments = data.row_groups->MoveSegments();
@@ -578,6 +583,7 @@ idx_t RowGroupCollection::Delete(TransactionData transaction, DataTable &table,
 //===--------------------------------------------------------------------===//
 void RowGroupCollection::Update(TransactionData transaction, row_t *ids, const vector<PhysicalIndex> &column_ids,
                                 DataChunk &updates) {
+	requires_clustering = true;
 	idx_t pos = 0;
 	do {
 		idx_t start = pos;
@@ -676,6 +682,7 @@ void RowGroupCollection::RemoveFromIndexes(TableIndexList &indexes, Vector &row_
 
 void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_ids, const vector<column_t> &column_path,
                                       DataChunk &updates) {
+	requires_clustering = true;
 	auto first_id = FlatVector::GetValue<row_t>(row_ids, 0);
 	if (first_id >= MAX_ROW_ID) {
 		throw NotImplementedException("Cannot update a column-path on transaction local data");
@@ -692,13 +699,31 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, Vector &row_i
 //===--------------------------------------------------------------------===//
 // Checkpoint State
 //===--------------------------------------------------------------------===//
+//! The state of a row group whose columns are being compressed and written by (possibly) separate tasks
+struct RowGroupCheckpointState {
+	RowGroupCheckpointState(RowGroupWriter &writer, vector<CompressionType> compression_types_p, idx_t column_count)
+	    : compression_types(std::move(compression_types_p)),
+	      info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType()), states(column_count),
+	      flush_queues(column_count), remaining_columns(column_count) {
+	}
+
+	vector<CompressionType> compression_types;
+	RowGroupWriteInfo info;
+	vector<unique_ptr<ColumnCheckpointState>> states;
+	vector<ColumnCheckpointFlushQueue> flush_queues;
+	atomic<idx_t> remaining_columns;
+};
+
 struct CollectionCheckpointState {
 	CollectionCheckpointState(RowGroupCollection &collection, TableDataWriter &writer,
 	                          vector<SegmentNode<RowGroup>> &segments, TableStatistics &global_stats)
 	    : collection(collection), writer(writer), executor(writer.GetScheduler()), segments(segments),
-	      global_stats(global_stats) {
+	      global_stats(global_stats), next_flush_idx(0), flushing(false) {
 		writers.resize(segments.size());
 		write_data.resize(segments.size());
+		row_group_states.resize(segments.size());
+		flush_ready.resize(segments.size(), false);
+		parallel_columns = writer.GetScheduler().NumberOfThreads() > 1;
 	}
 
 	RowGroupCollection &collection;
@@ -707,8 +732,72 @@ struct CollectionCheckpointState {
 	vector<SegmentNode<RowGroup>> &segments;
 	vector<unique_ptr<RowGroupWriter>> writers;
 	vector<RowGroupWriteData> write_data;
+	vector<unique_ptr<RowGroupCheckpointState>> row_group_states;
 	TableStatistics &global_stats;
 	mutex write_lock;
+	//! Whether or not the columns of a row group are written by separate tasks
+	bool parallel_columns;
+
+	//! The order in which the row groups are handed to the partial block manager - this is the order in which the
+	//! checkpoint tasks are scheduled, which does not depend on the order in which they finish
+	vector<idx_t> flush_order;
+	//! The row groups that have been written but not yet flushed
+	vector<bool> flush_ready;
+	idx_t next_flush_idx;
+	//! Whether or not a thread is currently flushing row groups
+	bool flushing;
+	mutex flush_lock;
+
+public:
+	//! Register that a checkpoint task for the row group at the given index will be scheduled
+	void ScheduleFlush(idx_t index) {
+		lock_guard<mutex> guard(flush_lock);
+		flush_order.push_back(index);
+	}
+
+	//! Write a single column of the row group at the given index
+	void WriteColumn(idx_t index, idx_t column_idx) {
+		auto &row_group = *segments[index].node;
+		auto &row_group_state = *row_group_states[index];
+		row_group_state.states[column_idx] =
+		    row_group.WriteColumnToDisk(row_group_state.info, column_idx, row_group_state.flush_queues[column_idx]);
+		if (--row_group_state.remaining_columns > 0) {
+			return;
+		}
+		// this was the last column of the row group to finish
+		write_data[index] = row_group.GetWriteData(std::move(row_group_state.states));
+		FinishRowGroup(index);
+	}
+
+	//! Mark a row group as written, and flush all written row groups whose turn it is
+	void FinishRowGroup(idx_t index) {
+		unique_lock<mutex> guard(flush_lock);
+		flush_ready[index] = true;
+		if (flushing) {
+			// another thread is flushing - it will pick up this row group
+			return;
+		}
+		flushing = true;
+		while (next_flush_idx < flush_order.size() && flush_ready[flush_order[next_flush_idx]]) {
+			auto flush_idx = flush_order[next_flush_idx++];
+			guard.unlock();
+			auto &row_group_state = *row_group_states[flush_idx];
+			for (auto &flush_queue : row_group_state.flush_queues) {
+				flush_queue.Flush();
+			}
+			row_group_states[flush_idx].reset();
+			guard.lock();
+		}
+		flushing = false;
+	}
+
+	//! Verify that all row groups have been flushed
+	void VerifyFlushed() {
+		lock_guard<mutex> guard(flush_lock);
+		if (next_flush_idx != flush_order.size()) {
+			throw InternalException("Not all row groups were flushed in RowGroupCollection::Checkpoint");
+		}
+	}
 };
 
 class BaseCheckpointTask : public BaseExecutorTask {
@@ -721,6 +810,22 @@ protected:
 	CollectionCheckpointState &checkpoint_state;
 };
 
+//! Compresses and writes a single column of a row group
+class ColumnCheckpointTask : public BaseCheckpointTask {
+public:
+	ColumnCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index, idx_t column_idx)
+	    : BaseCheckpointTask(checkpoint_state), index(index), column_idx(column_idx) {
+	}
+
+	void ExecuteTask() override {
+		checkpoint_state.WriteColumn(index, column_idx);
+	}
+
+private:
+	idx_t index;
+	idx_t column_idx;
+};
+
 class CheckpointTask : public BaseCheckpointTask {
 public:
 	CheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t index)
@@ -731,7 +836,24 @@ public:
 		auto &entry = checkpoint_state.segments[index];
 		auto &row_group = *entry.node;
 		checkpoint_state.writers[index] = checkpoint_state.writer.GetRowGroupWriter(*entry.node);
-		checkpoint_state.write_data[index] = row_group.WriteToDisk(*checkpoint_state.writers[index]);
+		auto &row_group_writer = *checkpoint_state.writers[index];
+
+		auto compression_types = row_group.GetCompressionTypes(row_group_writer);
+		auto column_count = compression_types.size();
+		checkpoint_state.row_group_states[index] =
+		    make_uniq<RowGroupCheckpointState>(row_group_writer, std::move(compression_types), column_count);
+		if (checkpoint_state.parallel_columns) {
+			// schedule the other columns as separate tasks - the task that finishes last finalizes the row group
+			for (idx_t column_idx = 1; column_idx < column_count; column_idx++) {
+				auto column_task = make_uniq<ColumnCheckpointTask>(checkpoint_state, index, column_idx);
+				checkpoint_state.executor.ScheduleTask(std::move(column_task));
+			}
+			checkpoint_state.WriteColumn(index, 0);
+			return;
+		}
+		for (idx_t column_idx = 0; column_idx < column_count; column_idx++) {
+			checkpoint_state.WriteColumn(index, column_idx);
+		}
 	}
 
 private:
@@ -946,6 +1068,9 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 	// schedule the vacuum task
 	auto vacuum_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, merge_count, target_count,
 	                                         merge_rows, state.row_start);
+	for (idx_t i = 0; i < target_count; i++) {
+		checkpoint_state.ScheduleFlush(segment_idx + i);
+	}
 	checkpoint_state.executor.ScheduleTask(std::move(vacuum_task));
 	// skip vacuuming by the row groups we have merged
 	state.next_vacuum_idx = next_idx;
@@ -965,6 +1090,15 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
 
+	// re-sort the table on its cluster key if it has been modified since the last checkpoint
+	// we can only rewrite the row groups if we are doing a full checkpoint and there are no indexes
+	auto cluster_columns = writer.GetClusterColumns();
+	if (!cluster_columns.empty() && requires_clustering &&
+	    writer.GetCheckpointType() == CheckpointType::FULL_CHECKPOINT && info->GetIndexes().Empty()) {
+		ClusterRowGroups(writer.GetScheduler(), segments, cluster_columns);
+		requires_clustering = false;
+	}
+
 	CollectionCheckpointState checkpoint_state(*this, writer, segments, global_stats);
 
 	VacuumState vacuum_state;
@@ -987,12 +1121,14 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		}
 		// schedule a checkpoint task for this row group
 		entry.node->MoveToCollection(*this, vacuum_state.row_start);
+		checkpoint_state.ScheduleFlush(segment_idx);
 		auto checkpoint_task = GetCheckpointTask(checkpoint_state, segment_idx);
 		checkpoint_state.executor.ScheduleTask(std::move(checkpoint_task));
 		vacuum_state.row_start += entry.node->count;
 	}
 	// all tasks have been scheduled - execute tasks until we are done
 	checkpoint_state.executor.WorkOnTasks();
+	checkpoint_state.VerifyFlushed();
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
@@ -1016,6 +1152,181 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 	total_rows = new_total_rows;
 }
 
+//! Sorts the committed rows of a range of row groups on the cluster key
+class ClusterSortTask : public BaseExecutorTask {
+public:
+	ClusterSortTask(TaskExecutor &executor, GlobalSortState &global_sort_state,
+	                vector<SegmentNode<RowGroup>> &segments, idx_t segment_start, idx_t segment_end,
+	                const vector<LogicalType> &types, const vector<idx_t> &cluster_columns, idx_t memory_per_thread)
+	    : BaseExecutorTask(executor), global_sort_state(global_sort_state), segments(segments),
+	      segment_start(segment_start), segment_end(segment_end), types(types), cluster_columns(cluster_columns),
+	      memory_per_thread(memory_per_thread) {
+	}
+
+	void ExecuteTask() override {
+		auto &buffer_manager = global_sort_state.buffer_manager;
+		LocalSortState local_sort_state;
+
+		DataChunk scan_chunk;
+		scan_chunk.Initialize(Allocator::DefaultAllocator(), types);
+		vector<LogicalType> key_types;
+		for (auto &column_idx : cluster_columns) {
+			key_types.push_back(types[column_idx]);
+		}
+		DataChunk keys;
+		keys.InitializeEmpty(key_types);
+		vector<column_t> column_ids;
+		for (idx_t c = 0; c < types.size(); c++) {
+			column_ids.push_back(c);
+		}
+		TableScanState scan_state;
+		scan_state.Initialize(column_ids);
+		scan_state.table_state.Initialize(types);
+		scan_state.table_state.max_row = idx_t(-1);
+		for (idx_t segment_idx = segment_start; segment_idx < segment_end; segment_idx++) {
+			auto &row_group = *segments[segment_idx].node;
+			row_group.InitializeScan(scan_state.table_state);
+			while (true) {
+				scan_chunk.Reset();
+				row_group.ScanCommitted(scan_state.table_state, scan_chunk,
+				                        TableScanType::TABLE_SCAN_LATEST_COMMITTED_ROWS);
+				if (scan_chunk.size() == 0) {
+					break;
+				}
+				if (!local_sort_state.initialized) {
+					local_sort_state.Initialize(global_sort_state, buffer_manager);
+				}
+				keys.ReferenceColumns(scan_chunk, cluster_columns);
+				local_sort_state.SinkChunk(keys, scan_chunk);
+				if (local_sort_state.SizeInBytes() >= memory_per_thread) {
+					local_sort_state.Sort(global_sort_state, true);
+				}
+			}
+		}
+		global_sort_state.AddLocalState(local_sort_state);
+	}
+
+private:
+	GlobalSortState &global_sort_state;
+	vector<SegmentNode<RowGroup>> &segments;
+	idx_t segment_start;
+	idx_t segment_end;
+	const vector<LogicalType> &types;
+	const vector<idx_t> &cluster_columns;
+	idx_t memory_per_thread;
+};
+
+//! Merges a part of the sorted runs of the cluster key sort
+class ClusterMergeTask : public BaseExecutorTask {
+public:
+	ClusterMergeTask(TaskExecutor &executor, GlobalSortState &global_sort_state)
+	    : BaseExecutorTask(executor), global_sort_state(global_sort_state) {
+	}
+
+	void ExecuteTask() override {
+		MergeSorter merge_sorter(global_sort_state, global_sort_state.buffer_manager);
+		merge_sorter.PerformInMergeRound();
+	}
+
+private:
+	GlobalSortState &global_sort_state;
+};
+
+void RowGroupCollection::ClusterRowGroups(TaskScheduler &scheduler, vector<SegmentNode<RowGroup>> &segments,
+                                          const vector<idx_t> &cluster_columns) {
+	idx_t total_count = 0;
+	for (auto &entry : segments) {
+		total_count += entry.node->GetCommittedRowCount();
+	}
+	if (total_count == 0) {
+		// nothing to sort - the empty row groups are dropped by the vacuum
+		return;
+	}
+	auto &buffer_manager = block_manager.buffer_manager;
+
+	// sort all committed rows of the table on the cluster key (ascending, NULLs last)
+	vector<BoundOrderByNode> orders;
+	for (auto &column_idx : cluster_columns) {
+		orders.emplace_back(OrderType::ASCENDING, OrderByNullType::NULLS_LAST,
+		                    make_uniq<BoundReferenceExpression>(types[column_idx], column_idx));
+	}
+	RowLayout payload_layout;
+	payload_layout.Initialize(types);
+	GlobalSortState global_sort_state(buffer_manager, orders, payload_layout);
+
+	// every thread sorts a contiguous range of row groups
+	auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	auto task_count = MinValue<idx_t>(thread_count, segments.size());
+	auto memory_per_thread = buffer_manager.GetQueryMaxMemory() / 4 / task_count;
+	TaskExecutor executor(scheduler);
+	for (idx_t task_idx = 0; task_idx < task_count; task_idx++) {
+		auto segment_start = segments.size() * task_idx / task_count;
+		auto segment_end = segments.size() * (task_idx + 1) / task_count;
+		executor.ScheduleTask(make_uniq<ClusterSortTask>(executor, global_sort_state, segments, segment_start,
+		                                                 segment_end, types, cluster_columns, memory_per_thread));
+	}
+	executor.WorkOnTasks();
+
+	// merge the sorted runs in parallel
+	global_sort_state.PrepareMergePhase();
+	while (global_sort_state.sorted_blocks.size() > 1) {
+		global_sort_state.InitializeMergeRound();
+		for (idx_t task_idx = 0; task_idx < thread_count; task_idx++) {
+			executor.ScheduleTask(make_uniq<ClusterMergeTask>(executor, global_sort_state));
+		}
+		executor.WorkOnTasks();
+		global_sort_state.CompleteMergeRound();
+	}
+
+	// write the sorted rows into a new set of row groups
+	vector<SegmentNode<RowGroup>> new_segments;
+	TableAppendState append_state;
+	idx_t append_count = 0;
+	idx_t start = row_start;
+	PayloadScanner scanner(global_sort_state);
+	DataChunk sorted_chunk;
+	sorted_chunk.Initialize(Allocator::DefaultAllocator(), types);
+	while (true) {
+		sorted_chunk.Reset();
+		scanner.Scan(sorted_chunk);
+		if (sorted_chunk.size() == 0) {
+			break;
+		}
+		idx_t remaining = sorted_chunk.size();
+		while (remaining > 0) {
+			if (new_segments.empty() || append_count == new_segments.back().node->count) {
+				// start the next row group
+				idx_t row_group_rows = MinValue<idx_t>(total_count - (start - row_start), Storage::ROW_GROUP_SIZE);
+				auto new_row_group = make_uniq<RowGroup>(*this, start, row_group_rows);
+				new_row_group->InitializeEmpty(types);
+				new_row_group->InitializeAppend(append_state.row_group_append_state);
+				new_segments.push_back(SegmentNode<RowGroup> {start, std::move(new_row_group)});
+				start += row_group_rows;
+				append_count = 0;
+			}
+			auto &row_group = *new_segments.back().node;
+			idx_t row_group_append = MinValue<idx_t>(remaining, row_group.count - append_count);
+			row_group.Append(append_state.row_group_append_state, sorted_chunk, row_group_append);
+			append_count += row_group_append;
+			remaining -= row_group_append;
+			if (remaining > 0) {
+				sorted_chunk.Slice(row_group_append, remaining);
+			}
+		}
+	}
+	if (start - row_start != total_count || append_count != new_segments.back().node->count) {
+		throw InternalException("Mismatch in row count while clustering in RowGroupCollection::Checkpoint");
+	}
+	// the old row groups have been fully rewritten - drop them
+	for (auto &entry : segments) {
+		entry.node->CommitDrop();
+	}
+	for (auto &entry : new_segments) {
+		entry.node->Verify();
+	}
+	segments = std::move(new_segments);
+}
+
 //===--------------------------------------------------------------------===//
 // CommitDrop
 //===--------------------------------------------------------------------===//
@@ -1056,6 +1367,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	DataChunk dummy_chunk;
 	Vector default_vector(new_column.GetType());
 
+	result->requires_clustering = requires_clustering.load();
 	result->stats.InitializeAddColumn(stats, new_column.GetType());
 	auto lock = result->stats.GetLock();
 	auto &new_column_stats = result->stats.GetStats(*lock, new_column_idx);
@@ -1079,6 +1391,7 @@ shared_ptr<RowGroupCollection> RowGroupCollection::RemoveColumn(idx_t col_idx) {
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	result->requires_clustering = requires_clustering.load();
 	result->stats.InitializeRemoveColumn(stats, col_idx);
 
 	for (auto &current_row_group : row_groups->Segments()) {
@@ -1097,6 +1410,8 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AlterType(ClientContext &cont
 
 	auto result =
 	    make_shared_ptr<RowGroupCollection>(info, block_manager, std::move(new_types), row_start, total_rows.load());
+	// the altered column might be part of the cluster key - re-cluster on the next checkpoint
+	result->requires_clustering = true;
 	result->stats.InitializeAlterType(stats, changed_idx, target_type);
 
 	vector<LogicalType> scan_types;
@@ -1,6 +1,11 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
+#include "lz4.hpp"
+
+#include <chrono>
 
 namespace duckdb {
 
@@ -8,10 +13,11 @@ namespace duckdb {
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), manager(&manager), block_size(block_size) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr), block_size(0) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -57,8 +63,11 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetUsedBlockCount() {
+	return indexes_in_use.size();
+}
+
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMP_FILE_BLOCK_SIZE = DEFAULT_BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +75,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMP_FILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +104,10 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      slot_size(slot_size), index_manager(manager, slot_size), compression_input_bytes(0), compression_time(0) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -117,17 +126,45 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	return TemporaryFileIndex(file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer, idx_t compression_time_p) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	if (compressed_buffer.IsSet()) {
+		compression_input_bytes += buffer.AllocSize();
+		compression_time += compression_time_p;
+	}
+	if (index.compression == TemporaryFileCompression::NONE) {
+		D_ASSERT(buffer.AllocSize() <= slot_size);
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	D_ASSERT(index.compressed_size <= slot_size);
+	handle->Write(compressed_buffer.get(), index.compressed_size, GetPositionInFile(index.block_index));
 }
 
-unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
+unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(TemporaryFileIndex index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(
-	    BufferManager::GetBufferManager(db), *handle, GetPositionInFile(block_index),
-	    BufferManager::GetBufferManager(db).GetBlockSize(), std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto position = GetPositionInFile(index.block_index);
+	if (index.compression == TemporaryFileCompression::NONE) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle, position,
+		                                                          buffer_manager.GetBlockSize(),
+		                                                          std::move(reusable_buffer));
+	}
+	// read the compressed block and decompress it into the buffer
+	D_ASSERT(index.compression == TemporaryFileCompression::LZ4);
+	auto compressed_buffer = Allocator::Get(db).Allocate(index.compressed_size);
+	handle->Read(compressed_buffer.get(), index.compressed_size, position);
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(buffer_manager.GetBlockSize(), std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer.get()), char_ptr_cast(buffer->InternalBuffer()),
+	    NumericCast<int>(index.compressed_size), NumericCast<int>(buffer->AllocSize()));
+	if (decompressed_size < 0 || NumericCast<idx_t>(decompressed_size) != buffer->AllocSize()) {
+		throw IOException("Failed to decompress block %llu of temporary file \"%s\"", index.block_index, path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -155,6 +192,11 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.slot_size = slot_size;
+	info.block_count = index_manager.GetUsedBlockCount();
+	info.uncompressed_size = info.block_count * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	info.compression_input_bytes = compression_input_bytes;
+	info.compression_time = compression_time;
 	return info;
 }
 
@@ -181,7 +223,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * BufferManager::GetBufferManager(db).GetBlockAllocSize();
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -277,17 +319,62 @@ TemporaryFileManager::~TemporaryFileManager() {
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, TemporaryFileIndex &index,
+                                           AllocatedData &compressed_buffer, idx_t &compression_time) {
+	// blocks are stored in slots that are a multiple of 1/8th of the block size
+	static constexpr const idx_t SLOTS_PER_BLOCK = 8;
+
+	auto block_alloc_size = buffer.AllocSize();
+	index.compression = TemporaryFileCompression::NONE;
+	index.compressed_size = block_alloc_size;
+	compression_time = 0;
+	if (DBConfig::GetConfig(db).options.temp_file_compression != TemporaryFileCompression::LZ4) {
+		return block_alloc_size;
+	}
+	auto start_time = std::chrono::steady_clock::now();
+	auto compressed_bound = duckdb_lz4::LZ4_compressBound(NumericCast<int>(block_alloc_size));
+	compressed_buffer = Allocator::Get(db).Allocate(NumericCast<idx_t>(compressed_bound));
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(buffer.InternalBuffer()),
+	                                                        char_ptr_cast(compressed_buffer.get()),
+	                                                        NumericCast<int>(block_alloc_size), compressed_bound);
+	auto end_time = std::chrono::steady_clock::now();
+	compression_time =
+	    NumericCast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count());
+	if (compressed_size <= 0) {
+		// compression failed - store the block uncompressed
+		return block_alloc_size;
+	}
+	auto slot_granularity = block_alloc_size / SLOTS_PER_BLOCK;
+	auto slot_size = (NumericCast<idx_t>(compressed_size) + slot_granularity - 1) / slot_granularity * slot_granularity;
+	if (slot_size >= block_alloc_size) {
+		// the block did not compress well enough to fit in a smaller slot - store it uncompressed
+		return block_alloc_size;
+	}
+	index.compression = TemporaryFileCompression::LZ4;
+	index.compressed_size = NumericCast<idx_t>(compressed_size);
+	return slot_size;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	// We group DEFAULT_BLOCK_ALLOC_SIZE blocks into the same file.
 	D_ASSERT(buffer.size == BufferManager::GetBufferManager(db).GetBlockSize());
+	// compress the buffer (if enabled) - this determines the size of the slot that the block is stored in
+	TemporaryFileIndex compressed_index;
+	AllocatedData compressed_buffer;
+	idx_t compression_time;
+	auto slot_size = CompressBuffer(buffer, compressed_index, compressed_buffer, compression_time);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with the right slot size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -297,18 +384,21 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
 			index = handle->TryGetBlockIndex();
 		}
+		index.compression = compressed_index.compression;
+		index.compressed_size = compressed_index.compressed_size;
 		D_ASSERT(used_blocks.find(block_id) == used_blocks.end());
 		used_blocks[block_id] = index;
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer, compression_time);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -374,7 +464,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 		index = GetTempBlockIndex(lock, id);
 		handle = GetFileHandle(lock, index.file_index);
 	}
-	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
+	auto buffer = handle->ReadTemporaryBuffer(index, std::move(reusable_buffer));
 	{
 		// remove the block (and potentially erase the temp file)
 		TemporaryManagerLock lock(manager_lock);
@@ -1,6 +1,7 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/resource_group.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -105,6 +106,10 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
 	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
 	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	auto &resource_group = ClientConfig::GetConfig(context).resource_group;
+	if (!resource_group.empty()) {
+		result->resource_group = TaskScheduler::GetScheduler(context).GetResourceGroupManager().GetGroup(resource_group);
+	}
 	SetRemainingSize(*result, result->GetMinimumReservation());
 	SetReservation(*result, result->GetMinimumReservation());
 	active_states.insert(*result);
@@ -149,6 +154,9 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		} else {
 			new_reservation = remaining_size > memory_limit ? ComputeReservation(temporary_memory_state) : upper_bound;
 		}
+		// The reservation is also bounded by the memory limit of the resource group (but never below the lower bound)
+		const auto group_bound = ComputeResourceGroupBound(temporary_memory_state);
+		new_reservation = MaxValue(lower_bound, MinValue(new_reservation, group_bound));
 
 		SetReservation(temporary_memory_state, new_reservation);
 	}
@@ -166,10 +174,26 @@ void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_me
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.GetReservation());
 	this->reservation -= temporary_memory_state.GetReservation();
+	if (temporary_memory_state.resource_group) {
+		auto &group_reservation = temporary_memory_state.resource_group->memory_reservation;
+		group_reservation -= temporary_memory_state.GetReservation();
+		group_reservation += new_reservation;
+	}
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.GetReservation();
 }
 
+idx_t TemporaryMemoryManager::ComputeResourceGroupBound(const TemporaryMemoryState &temporary_memory_state) {
+	auto &resource_group = temporary_memory_state.resource_group;
+	if (!resource_group || !resource_group->max_memory.IsValid()) {
+		return NumericLimits<idx_t>::Maximum();
+	}
+	// The memory that is reserved by the other states of the resource group
+	const auto group_reservation = resource_group->memory_reservation - temporary_memory_state.GetReservation();
+	const auto group_limit = resource_group->max_memory.GetIndex();
+	return group_limit > group_reservation ? group_limit - group_reservation : 0;
+}
+
 //! Compute initial reservation for use in ComputeReservation
 static idx_t ComputeInitialReservation(const TemporaryMemoryState &temporary_memory_state) {
 	// Maximum of minimum reservation and the current reservation
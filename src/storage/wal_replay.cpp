@@ -29,9 +29,33 @@
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/storage/optimistic_data_writer.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
 
+//! An INSERT_TUPLE entry whose deserialization and append is deferred so it can be replayed in parallel
+struct DeferredInsert {
+	DeferredInsert(unique_ptr<data_t[]> data_p, idx_t size) : data(std::move(data_p)), size(size) {
+	}
+
+	unique_ptr<data_t[]> data;
+	idx_t size;
+};
+
+//! The deferred inserts of a single table, in WAL order
+struct DeferredTableInserts {
+	explicit DeferredTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	reference<TableCatalogEntry> table;
+	vector<DeferredInsert> entries;
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
@@ -43,18 +67,31 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! Inserts that have been read from the WAL but not yet applied
+	vector<DeferredTableInserts> deferred_inserts;
+	idx_t deferred_insert_count = 0;
+
+public:
+	//! Defer an insert into the current table
+	void DeferInsert(unique_ptr<data_t[]> data, idx_t size);
+	//! Apply all deferred inserts - inserts into different tables, and different row groups of the same table, are
+	//! deserialized and appended in parallel
+	void ReplayDeferredInserts();
+
+private:
+	void ReplayDeferredInsertsSequential();
 };
 
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
-	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr),
+	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(nullptr), data_size(0),
 	      stream(nullptr, 0), deserializer(stream_p), deserialize_only(deserialize_only) {
 	}
 	WriteAheadLogDeserializer(ReplayState &state_p, unique_ptr<data_t[]> data_p, idx_t size,
 	                          bool deserialize_only = false)
 	    : state(state_p), db(state.db), context(state.context), catalog(state.catalog), data(std::move(data_p)),
-	      stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
+	      data_size(size), stream(data.get(), size), deserializer(stream), deserialize_only(deserialize_only) {
 	}
 
 	static WriteAheadLogDeserializer Open(ReplayState &state_p, BufferedFileReader &stream,
@@ -97,6 +134,20 @@ public:
 	bool ReplayEntry() {
 		deserializer.Begin();
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (!deserialize_only) {
+			if (wal_type == WALType::INSERT_TUPLE && data) {
+				// defer the insert - the entry is deserialized again when the deferred inserts are replayed
+				if (!state.current_table) {
+					throw InternalException("Corrupt WAL: insert without table");
+				}
+				state.DeferInsert(std::move(data), data_size);
+				return false;
+			}
+			if (wal_type != WALType::USE_TABLE) {
+				// any other entry might depend on the inserts: apply them first
+				state.ReplayDeferredInserts();
+			}
+		}
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
 			return true;
@@ -106,6 +157,19 @@ public:
 		return false;
 	}
 
+	//! Deserialize the chunk of an INSERT_TUPLE entry
+	static void DeserializeInsert(const DeferredInsert &entry, DataChunk &chunk) {
+		MemoryStream entry_stream(entry.data.get(), entry.size);
+		BinaryDeserializer entry_deserializer(entry_stream);
+		entry_deserializer.Begin();
+		auto wal_type = entry_deserializer.ReadProperty<WALType>(100, "wal_type");
+		if (wal_type != WALType::INSERT_TUPLE) {
+			throw InternalException("Deferred WAL entry is not an insert");
+		}
+		entry_deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+		entry_deserializer.End();
+	}
+
 	bool DeserializeOnly() {
 		return deserialize_only;
 	}
@@ -154,11 +218,150 @@ private:
 	ClientContext &context;
 	Catalog &catalog;
 	unique_ptr<data_t[]> data;
+	idx_t data_size;
 	MemoryStream stream;
 	BinaryDeserializer deserializer;
 	bool deserialize_only;
 };
 
+//===--------------------------------------------------------------------===//
+// Deferred Inserts
+//===--------------------------------------------------------------------===//
+//! The number of insert entries (of up to STANDARD_VECTOR_SIZE rows each) appended by a single replay task
+static constexpr idx_t REPLAY_INSERTS_PER_TASK = Storage::ROW_GROUP_VECTOR_COUNT * 2;
+
+void ReplayState::DeferInsert(unique_ptr<data_t[]> data, idx_t size) {
+	D_ASSERT(current_table);
+	optional_ptr<DeferredTableInserts> table_inserts;
+	for (auto &entry : deferred_inserts) {
+		if (RefersToSameObject(entry.table.get(), *current_table)) {
+			table_inserts = entry;
+			break;
+		}
+	}
+	if (!table_inserts) {
+		deferred_inserts.emplace_back(*current_table);
+		table_inserts = deferred_inserts.back();
+	}
+	table_inserts->entries.emplace_back(std::move(data), size);
+	deferred_insert_count++;
+
+	// bound the amount of WAL data that is kept in memory
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	auto max_deferred = NumericCast<idx_t>(scheduler.NumberOfThreads()) * REPLAY_INSERTS_PER_TASK;
+	if (deferred_insert_count >= max_deferred) {
+		ReplayDeferredInserts();
+	}
+}
+
+void ReplayState::ReplayDeferredInsertsSequential() {
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	for (auto &table_inserts : deferred_inserts) {
+		auto &table = table_inserts.table.get();
+		for (auto &entry : table_inserts.entries) {
+			DataChunk chunk;
+			WriteAheadLogDeserializer::DeserializeInsert(entry, chunk);
+			// we don't do any constraint verification here
+			table.GetStorage().LocalAppend(table, context, chunk, bound_constraints);
+		}
+	}
+}
+
+//! Appends a range of the deferred inserts of a table into a separate row group collection
+struct DeferredInsertRange {
+	DeferredInsertRange(DeferredTableInserts &table_inserts, idx_t start, idx_t end)
+	    : table_inserts(table_inserts), start(start), end(end) {
+	}
+
+	DeferredTableInserts &table_inserts;
+	idx_t start;
+	idx_t end;
+	unique_ptr<RowGroupCollection> collection;
+	optional_ptr<OptimisticDataWriter> writer;
+};
+
+class DeferredInsertTask : public BaseExecutorTask {
+public:
+	DeferredInsertTask(TaskExecutor &executor, DeferredInsertRange &range) : BaseExecutorTask(executor), range(range) {
+	}
+
+	void ExecuteTask() override {
+		auto &collection = *range.collection;
+		TableAppendState append_state;
+		collection.InitializeAppend(append_state);
+		for (idx_t i = range.start; i < range.end; i++) {
+			DataChunk chunk;
+			WriteAheadLogDeserializer::DeserializeInsert(range.table_inserts.entries[i], chunk);
+			auto new_row_group = collection.Append(chunk, append_state);
+			if (new_row_group) {
+				range.writer->WriteNewRowGroup(collection);
+			}
+		}
+		TransactionData tdata(0, 0);
+		collection.FinalizeAppend(tdata, append_state);
+	}
+
+private:
+	DeferredInsertRange &range;
+};
+
+void ReplayState::ReplayDeferredInserts() {
+	if (deferred_inserts.empty()) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (scheduler.NumberOfThreads() <= 1 || deferred_insert_count <= REPLAY_INSERTS_PER_TASK) {
+		// not enough work to replay in parallel
+		ReplayDeferredInsertsSequential();
+	} else {
+		// split the inserts of every table into ranges that are appended to separate collections in parallel
+		vector<DeferredInsertRange> ranges;
+		for (auto &table_inserts : deferred_inserts) {
+			auto &entries = table_inserts.entries;
+			for (idx_t start = 0; start < entries.size(); start += REPLAY_INSERTS_PER_TASK) {
+				auto end = MinValue<idx_t>(start + REPLAY_INSERTS_PER_TASK, entries.size());
+				ranges.emplace_back(table_inserts, start, end);
+			}
+		}
+		TaskExecutor executor(context);
+		for (auto &range : ranges) {
+			auto &table = range.table_inserts.table.get();
+			auto &storage = table.GetStorage();
+			auto &block_manager = TableIOManager::Get(storage).GetBlockManagerForRowData();
+			range.collection = make_uniq<RowGroupCollection>(storage.GetDataTableInfo(), block_manager,
+			                                                 storage.GetTypes(), NumericCast<idx_t>(MAX_ROW_ID));
+			range.collection->InitializeEmpty();
+			range.writer = storage.CreateOptimisticWriter(context);
+			executor.ScheduleTask(make_uniq<DeferredInsertTask>(executor, range));
+		}
+		executor.WorkOnTasks();
+
+		// merge the collections into the transaction-local storage in WAL order
+		vector<unique_ptr<BoundConstraint>> bound_constraints;
+		auto &transaction = DuckTransaction::Get(context, db);
+		for (auto &range : ranges) {
+			auto &table = range.table_inserts.table.get();
+			auto &storage = table.GetStorage();
+			auto &collection = *range.collection;
+			if (collection.GetTotalRows() < Storage::ROW_GROUP_SIZE) {
+				// few rows - append them to the local storage directly so they end up in the same row groups
+				LocalAppendState append_state;
+				storage.InitializeLocalAppend(append_state, table, context, bound_constraints);
+				collection.Scan(transaction, [&](DataChunk &insert_chunk) {
+					storage.LocalAppend(append_state, table, context, insert_chunk);
+					return true;
+				});
+				storage.FinalizeLocalAppend(append_state);
+			} else {
+				storage.LocalMerge(context, collection);
+			}
+			storage.FinalizeOptimisticWriter(context, *range.writer);
+		}
+	}
+	deferred_inserts.clear();
+	deferred_insert_count = 0;
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
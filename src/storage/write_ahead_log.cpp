@@ -16,13 +16,18 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/storage/table/column_data.hpp"
+#include "duckdb/common/error_data.hpp"
+
+#include <chrono>
+#include <thread>
 
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : database(database), wal_path(wal_path), wal_size(0), initialized(false) {
+    : database(database), wal_path(wal_path), wal_size(0), initialized(false), flushed_offset(0), synced_offset(0),
+      sync_in_progress(false) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -421,6 +426,74 @@ void WriteAheadLog::Flush() {
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+
+	// everything that was flushed without sync before is now durable as well
+	lock_guard<mutex> guard(sync_lock);
+	flushed_offset = wal_size.load();
+	synced_offset = flushed_offset;
+}
+
+idx_t WriteAheadLog::FlushWithoutSync() {
+	if (!writer) {
+		return 0;
+	}
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// hand the changes to the OS - the sync happens in WaitForSync, potentially shared with other commits
+	writer->Flush();
+	wal_size = writer->GetFileSize();
+	flushed_offset = wal_size.load();
+	return flushed_offset;
+}
+
+optional_idx WriteAheadLog::GetPendingSyncOffset() {
+	lock_guard<mutex> guard(sync_lock);
+	if (flushed_offset <= synced_offset) {
+		return optional_idx();
+	}
+	return flushed_offset.load();
+}
+
+void WriteAheadLog::WaitForSync(idx_t offset, idx_t max_delay) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_offset < offset) {
+		if (!sync_error.empty()) {
+			throw IOException("Failed to sync the write-ahead log: %s", sync_error);
+		}
+		if (sync_in_progress) {
+			// another thread is syncing - wait for it to finish and check whether that sync covered our offset
+			sync_cv.wait(guard);
+			continue;
+		}
+		// no sync is running: this thread syncs on behalf of the group
+		sync_in_progress = true;
+		guard.unlock();
+		if (max_delay > 0) {
+			// give concurrent commits the chance to flush their entries so they can share this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(max_delay));
+		}
+		// everything that was flushed before the sync starts is durable once the sync completes
+		idx_t sync_target = flushed_offset;
+		string error;
+		try {
+			writer->handle->Sync();
+		} catch (std::exception &ex) {
+			ErrorData data(ex);
+			error = data.RawMessage();
+		}
+		guard.lock();
+		if (error.empty()) {
+			synced_offset = MaxValue<idx_t>(synced_offset, sync_target);
+		} else {
+			// a failed sync cannot be retried safely - the OS may have dropped the dirty pages
+			sync_error = error;
+		}
+		sync_in_progress = false;
+		sync_cv.notify_all();
+	}
 }
 
 } // namespace duckdb
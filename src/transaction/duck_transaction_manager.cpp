@@ -13,10 +13,94 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
+#include "duckdb/common/profiler.hpp"
+
+#ifndef DUCKDB_NO_THREADS
+#include "duckdb/common/thread.hpp"
+#include <condition_variable>
+#endif
 
 namespace duckdb {
 
+//! The background checkpointer performs automatic checkpoints in a separate thread, so that transactions that push
+//! the WAL over the checkpoint threshold do not have to wait for the checkpoint to complete
+class BackgroundCheckpointer {
+public:
+	//! The interval (in milliseconds) at which a checkpoint is retried if the checkpoint lock could not be obtained
+	static constexpr const int64_t RETRY_INTERVAL_MS = 10;
+
+public:
+	explicit BackgroundCheckpointer(DuckTransactionManager &manager) : manager(manager) {
+#ifndef DUCKDB_NO_THREADS
+		checkpoint_thread = make_uniq<thread>([this]() { Run(); });
+#endif
+	}
+	~BackgroundCheckpointer() {
+		Stop();
+	}
+
+	void RequestCheckpoint() {
+#ifndef DUCKDB_NO_THREADS
+		lock_guard<mutex> guard(lock);
+		requested = true;
+		cv.notify_one();
+#endif
+	}
+
+	void Stop() {
+#ifndef DUCKDB_NO_THREADS
+		{
+			lock_guard<mutex> guard(lock);
+			shutdown = true;
+			cv.notify_one();
+		}
+		if (checkpoint_thread && checkpoint_thread->joinable()) {
+			checkpoint_thread->join();
+		}
+		checkpoint_thread.reset();
+#endif
+	}
+
+private:
+#ifndef DUCKDB_NO_THREADS
+	void Run() {
+		unique_lock<mutex> guard(lock);
+		while (!shutdown) {
+			if (!requested) {
+				cv.wait(guard);
+				continue;
+			}
+			requested = false;
+			guard.unlock();
+			bool finished = true;
+			try {
+				finished = manager.TryBackgroundCheckpoint();
+			} catch (...) { // NOLINT
+				// the error is recorded in the checkpoint history
+			}
+			guard.lock();
+			if (!finished && !shutdown) {
+				// we could not obtain the checkpoint lock because write transactions are active - retry later on
+				requested = true;
+				cv.wait_for(guard, std::chrono::milliseconds(RETRY_INTERVAL_MS));
+			}
+		}
+	}
+#endif
+
+private:
+	DuckTransactionManager &manager;
+#ifndef DUCKDB_NO_THREADS
+	unique_ptr<thread> checkpoint_thread;
+	mutex lock;
+	std::condition_variable cv;
+	bool requested = false;
+	bool shutdown = false;
+#endif
+};
+
 DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
@@ -34,6 +118,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	StopBackgroundCheckpointer();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -104,6 +189,14 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (config.options.debug_skip_checkpoint_on_commit) {
 		return CheckpointDecision("checkpointing on commit disabled through configuration");
 	}
+#ifndef DUCKDB_NO_THREADS
+	if (config.options.background_checkpoint) {
+		// the checkpoint is performed by the background checkpointer after this transaction has committed
+		CheckpointDecision decision("checkpoint is performed by the background checkpointer");
+		decision.background_checkpoint = true;
+		return decision;
+	}
+#endif
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -190,12 +283,122 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 			lock = checkpoint_lock.TryGetExclusiveLock();
 		}
 	}
+	Profiler lock_timer;
+	lock_timer.Start();
 	CheckpointOptions options;
 	if (GetLastCommit() > LowestActiveStart()) {
 		// we cannot do a full checkpoint if any transaction needs to read old data
 		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
 	}
-	storage_manager.CreateCheckpoint(options);
+	PerformCheckpoint(options, CheckpointTrigger::MANUAL, lock_timer);
+}
+
+void DuckTransactionManager::AddCheckpointHistory(CheckpointHistoryEntry entry) {
+	static constexpr const idx_t MAX_CHECKPOINT_HISTORY = 1024;
+	lock_guard<mutex> guard(checkpoint_history_lock);
+	if (checkpoint_history.size() >= MAX_CHECKPOINT_HISTORY) {
+		checkpoint_history.erase(checkpoint_history.begin());
+	}
+	checkpoint_history.push_back(std::move(entry));
+}
+
+void DuckTransactionManager::PerformCheckpoint(CheckpointOptions options, CheckpointTrigger trigger,
+                                               Profiler &lock_timer) {
+	auto &storage_manager = db.GetStorageManager();
+
+	CheckpointHistoryEntry entry;
+	entry.trigger = trigger;
+	entry.type = options.type;
+	entry.start_time = Timestamp::GetCurrentTimestamp();
+	entry.wal_size = storage_manager.GetWALSize();
+
+	Profiler profiler;
+	profiler.Start();
+	auto add_to_history = [&]() {
+		profiler.End();
+		lock_timer.End();
+		entry.duration = profiler.Elapsed();
+		entry.commit_stall = lock_timer.Elapsed();
+		AddCheckpointHistory(entry);
+	};
+	try {
+		storage_manager.CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		ErrorData error(ex);
+		entry.error = error.RawMessage();
+		add_to_history();
+		throw;
+	}
+	add_to_history();
+}
+
+vector<CheckpointHistoryEntry> DuckTransactionManager::GetCheckpointHistory() {
+	lock_guard<mutex> guard(checkpoint_history_lock);
+	return checkpoint_history;
+}
+
+void DuckTransactionManager::RequestBackgroundCheckpoint() {
+	lock_guard<mutex> guard(background_checkpointer_lock);
+	if (background_checkpointer_stopped) {
+		// the database is being closed
+		return;
+	}
+	if (!background_checkpointer) {
+		background_checkpointer = make_uniq<BackgroundCheckpointer>(*this);
+	}
+	background_checkpointer->RequestCheckpoint();
+}
+
+void DuckTransactionManager::StopBackgroundCheckpointer() {
+	unique_ptr<BackgroundCheckpointer> checkpointer;
+	{
+		lock_guard<mutex> guard(background_checkpointer_lock);
+		background_checkpointer_stopped = true;
+		checkpointer = std::move(background_checkpointer);
+	}
+	if (checkpointer) {
+		// wait for any running checkpoint to finish
+		checkpointer->Stop();
+	}
+}
+
+bool DuckTransactionManager::TryBackgroundCheckpoint() {
+	auto &storage_manager = db.GetStorageManager();
+	Profiler lock_timer;
+	CheckpointOptions options;
+	options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+	unique_ptr<StorageLockKey> lock;
+	try {
+		lock = checkpoint_lock.TryGetExclusiveLock();
+		if (!lock) {
+			// there are active write transactions - we need to retry later
+			return false;
+		}
+		lock_timer.Start();
+		if (!storage_manager.AutomaticCheckpoint(0)) {
+			// another checkpoint has already been performed in the meantime
+			return true;
+		}
+		if (GetLastCommit() > LowestActiveStart()) {
+			// we cannot do a full checkpoint if any transaction needs to read old data
+			options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		}
+	} catch (std::exception &ex) {
+		// the checkpoint failed before it was started - record the error in the checkpoint history as well
+		ErrorData error(ex);
+		CheckpointHistoryEntry entry;
+		entry.trigger = CheckpointTrigger::BACKGROUND;
+		entry.type = options.type;
+		entry.start_time = Timestamp::GetCurrentTimestamp();
+		entry.wal_size = storage_manager.GetWALSize();
+		entry.duration = 0;
+		entry.commit_stall = lock ? lock_timer.Elapsed() : 0;
+		entry.error = error.RawMessage();
+		AddCheckpointHistory(std::move(entry));
+		throw;
+	}
+	PerformCheckpoint(options, CheckpointTrigger::BACKGROUND, lock_timer);
+	return true;
 }
 
 unique_ptr<StorageLockKey> DuckTransactionManager::SharedCheckpointLock() {
@@ -228,6 +431,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
+	// the checkpoint lock (if obtained) is held exclusively from here on
+	Profiler lock_timer;
+	lock_timer.Start();
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
@@ -269,6 +475,9 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 			transaction.catalog_version = ++last_committed_version;
 		}
 	}
+	if (held_wal_lock && !error.HasError()) {
+		error = WaitForWALSync(tlock, held_wal_lock);
+	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
 	if (!checkpoint_decision.can_checkpoint && lock) {
@@ -290,9 +499,42 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		CheckpointOptions options;
 		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
 		options.type = checkpoint_decision.type;
-		auto &storage_manager = db.GetStorageManager();
-		storage_manager.CreateCheckpoint(options);
+		PerformCheckpoint(options, CheckpointTrigger::COMMIT, lock_timer);
+	} else if (checkpoint_decision.background_checkpoint && !error.HasError()) {
+		tlock.unlock();
+		RequestBackgroundCheckpoint();
+	}
+	return error;
+}
+
+ErrorData DuckTransactionManager::WaitForWALSync(unique_lock<mutex> &tlock,
+                                                 unique_ptr<lock_guard<mutex>> &held_wal_lock) {
+	auto wal = db.GetStorageManager().GetWAL();
+	if (!wal) {
+		return ErrorData();
+	}
+	auto sync_offset = wal->GetPendingSyncOffset();
+	if (!sync_offset.IsValid()) {
+		// the commit was synced as part of the flush
+		return ErrorData();
+	}
+	// group commit: the commit has been written to the WAL but not synced yet
+	// we release both locks so other transactions can write their commits to the WAL and share our sync
+	// note that the transaction is already committed in memory - the write lock of the transaction prevents a
+	// checkpoint from resetting the WAL while we are waiting
+	auto &config = DBConfig::Get(db);
+	idx_t max_delay = active_transactions.size() > 1 ? config.options.wal_group_commit_delay : 0;
+	held_wal_lock.reset();
+	tlock.unlock();
+	ErrorData error;
+	try {
+		wal->WaitForSync(sync_offset.GetIndex(), max_delay);
+	} catch (std::exception &ex) {
+		// the commit is visible in memory but could not be made durable - we cannot continue safely
+		error = ErrorData(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
 	}
+	tlock.lock();
 	return error;
 }
 
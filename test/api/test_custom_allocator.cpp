@@ -54,3 +54,37 @@ TEST_CASE("Test using a custom allocator", "[api][.]") {
 	// check that the memory counter usage has decreased after we dropped the table
 	REQUIRE(memory_counter.load() < table_memory_usage);
 }
+
+static idx_t GetTaggedMemory(Connection &con, const string &tag) {
+	auto result = con.Query("SELECT memory_usage_bytes FROM duckdb_memory() WHERE tag = '" + tag + "'");
+	REQUIRE_NO_FAIL(*result);
+	return result->GetValue(0, 0).GetValue<idx_t>();
+}
+
+TEST_CASE("Test that aggregate states and window data are charged to their memory tags", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	Connection monitor(db);
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=1"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE strings AS SELECT i % 100000 AS g, 'thisisalongerstring' || i AS s "
+	                          "FROM range(1000000) t(i)"));
+
+	// the aggregate states are alive while the groups are being fetched
+	auto result = con.SendQuery("SELECT g, STRING_AGG(s, ',') FROM strings GROUP BY g");
+	REQUIRE_NO_FAIL(*result);
+	auto chunk = result->Fetch();
+	REQUIRE(chunk);
+	REQUIRE(GetTaggedMemory(monitor, "AGGREGATE_STATE") > 0);
+	result.reset();
+	REQUIRE(GetTaggedMemory(monitor, "AGGREGATE_STATE") == 0);
+
+	// the window partitions and segment trees are alive while the window results are being fetched
+	result = con.SendQuery("SELECT COUNT(s) OVER (PARTITION BY g % 10 ORDER BY s ROWS BETWEEN 100 PRECEDING AND "
+	                       "CURRENT ROW) FROM strings");
+	REQUIRE_NO_FAIL(*result);
+	chunk = result->Fetch();
+	REQUIRE(chunk);
+	REQUIRE(GetTaggedMemory(monitor, "WINDOW") > 0);
+	result.reset();
+	REQUIRE(GetTaggedMemory(monitor, "WINDOW") == 0);
+}
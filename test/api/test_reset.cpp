@@ -106,7 +106,10 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"http_proxy_password", {"doe"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
 	    {"allocator_flush_threshold", {"4.0 GiB"}},
-	    {"allocator_bulk_deallocation_flush_threshold", {"4.0 GiB"}}};
+	    {"allocator_bulk_deallocation_flush_threshold", {"4.0 GiB"}},
+	    {"temp_file_compression", {"lz4"}},
+	    {"task_priority", {"high"}},
+	    {"huge_page_memory_tags", {"order_by", "ORDER_BY"}}};
 	// Every option that's not excluded has to be part of this map
 	if (!value_map.count(name)) {
 		switch (type) {
@@ -155,7 +158,8 @@ bool OptionIsExcludedFromTest(const string &name) {
 	    "custom_user_agent",
 	    "default_block_size",
 	    "index_scan_percentage",
-	    "index_scan_max_count"};
+	    "index_scan_max_count",
+	    "resource_group"}; // requires an existing resource group
 	return excluded_options.count(name) == 1;
 }
 
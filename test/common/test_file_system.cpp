@@ -97,6 +97,49 @@ TEST_CASE("Test file operations", "[file_system]") {
 	fs->RemoveFile(fname);
 }
 
+TEST_CASE("Test batched file reads", "[file_system]") {
+	duckdb::unique_ptr<FileSystem> fs = FileSystem::CreateLocal();
+	duckdb::unique_ptr<FileHandle> handle;
+	constexpr idx_t value_count = 128 * 1024;
+	duckdb::vector<int64_t> test_data(value_count);
+	for (idx_t i = 0; i < value_count; i++) {
+		test_data[i] = int64_t(i);
+	}
+
+	auto fname = TestCreatePath("test_batch_file");
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE));
+	REQUIRE_NOTHROW(handle->Write((void *)test_data.data(), sizeof(int64_t) * value_count, 0));
+	handle.reset();
+
+	// read more ranges than can be in flight at once, of varying sizes and in a random order
+	REQUIRE_NOTHROW(handle = fs->OpenFile(fname, FileFlags::FILE_FLAGS_READ));
+	constexpr idx_t range_count = 200;
+	duckdb::vector<duckdb::vector<int64_t>> buffers(range_count);
+	duckdb::vector<idx_t> range_starts(range_count);
+	duckdb::vector<FileReadRequest> requests;
+	for (idx_t i = 0; i < range_count; i++) {
+		auto range_start = (i * 7919) % (value_count - 1000);
+		auto range_size = 1 + (i * 13) % 1000;
+		range_starts[i] = range_start;
+		buffers[i].resize(range_size);
+		requests.emplace_back(buffers[i].data(), range_size * sizeof(int64_t), range_start * sizeof(int64_t));
+	}
+	REQUIRE_NOTHROW(handle->ReadBatch(requests));
+	for (idx_t i = 0; i < range_count; i++) {
+		for (idx_t k = 0; k < buffers[i].size(); k++) {
+			REQUIRE(buffers[i][k] == int64_t(range_starts[i] + k));
+		}
+	}
+
+	// reading past the end of the file fails
+	int64_t value;
+	requests.emplace_back(&value, sizeof(int64_t), value_count * sizeof(int64_t));
+	REQUIRE_THROWS(handle->ReadBatch(requests));
+
+	handle.reset();
+	fs->RemoveFile(fname);
+}
+
 TEST_CASE("absolute paths", "[file_system]") {
 	duckdb::LocalFileSystem fs;
 
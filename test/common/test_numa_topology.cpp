@@ -0,0 +1,34 @@
+#include "catch.hpp"
+#include "duckdb/common/numa_topology.hpp"
+
+using namespace duckdb;
+
+TEST_CASE("Test parsing of sysfs CPU lists", "[numa]") {
+	// single CPUs and ranges
+	REQUIRE(NumaTopology::ParseCPUList("0") == duckdb::vector<idx_t> {0});
+	REQUIRE(NumaTopology::ParseCPUList("0-3") == duckdb::vector<idx_t> {0, 1, 2, 3});
+	REQUIRE(NumaTopology::ParseCPUList("5-5") == duckdb::vector<idx_t> {5});
+	REQUIRE(NumaTopology::ParseCPUList("12") == duckdb::vector<idx_t> {12});
+
+	// comma-separated lists
+	REQUIRE(NumaTopology::ParseCPUList("0,2,4") == duckdb::vector<idx_t> {0, 2, 4});
+	REQUIRE(NumaTopology::ParseCPUList("0-3,8,10-11") == duckdb::vector<idx_t> {0, 1, 2, 3, 8, 10, 11});
+	REQUIRE(NumaTopology::ParseCPUList("16-17,0-1") == duckdb::vector<idx_t> {16, 17, 0, 1});
+
+	// empty lists
+	REQUIRE(NumaTopology::ParseCPUList("").empty());
+
+	// malformed lists
+	REQUIRE(NumaTopology::ParseCPUList("abc").empty());
+	REQUIRE(NumaTopology::ParseCPUList("1x").empty());
+	REQUIRE(NumaTopology::ParseCPUList(" 1").empty());
+	REQUIRE(NumaTopology::ParseCPUList("-1").empty());
+	REQUIRE(NumaTopology::ParseCPUList("1-").empty());
+	REQUIRE(NumaTopology::ParseCPUList("1-2-3").empty());
+	REQUIRE(NumaTopology::ParseCPUList("3-1").empty());
+	REQUIRE(NumaTopology::ParseCPUList("0,,1").empty());
+	REQUIRE(NumaTopology::ParseCPUList(",0").empty());
+	REQUIRE(NumaTopology::ParseCPUList("0,").empty());
+	REQUIRE(NumaTopology::ParseCPUList("0-18446744073709551615").empty());
+	REQUIRE(NumaTopology::ParseCPUList("99999999999999999999999").empty());
+}
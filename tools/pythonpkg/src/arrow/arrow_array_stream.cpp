@@ -378,6 +378,11 @@ py::object TransformFilterRecursive(TableFilter *filter, vector<string> &column_
 
 		return child_expr;
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		//! The value of a dynamic filter is only known while the scan runs - we do not filter the stream on it
+		py::object dataset_scalar = import_cache.pyarrow.dataset().attr("scalar");
+		return dataset_scalar(true);
+	}
 	default:
 		throw NotImplementedException("Pushdown Filter Type not supported in Arrow Scans");
 	}